@@ -15,7 +15,7 @@
  */
 void CustomerDash::onEvent(events::Plant e)  
 {
-    if (e.type == events::PlantType::Matured) maturedIds.push_back(e.plantId);
+    if (e.type == events::PlantType::Matured) maturedIds.push_back(e.plantId.str());
 }
 
 /**
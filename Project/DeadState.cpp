@@ -11,7 +11,7 @@
  * Since this is a terminal state, no transitions occur and no modifications
  * are made to the plant's attributes.
  */
-void DeadState::checkChange(Plant&)
+void DeadState::checkChange(Plant&, const TickContext&)
 {
 
 }
@@ -22,11 +22,14 @@ public:
 	/**
 	 * @brief Checks plant conditions (no state changes possible from Dead state)
 	 * @param plant Reference to the Plant object (unused in this state)
+	 * @param context Frozen time and season of the current tick (unused)
 	 *
 	 * This is a terminal state with no possible transitions, so this method
 	 * performs no operations.
 	 */
-    void checkChange(Plant& plant) override;
+    void checkChange(Plant& plant, const TickContext& context) override;
+
+    using PlantState::checkChange;
 
 	/**
 	 * @brief Gets the name of this state
@@ -1,14 +1,17 @@
 #include "DesertFactory.h"
 DesertStrategy DesertFactory::s;
 
-Pot* DesertFactory::createPot() 
+TerracottaPot DesertFactory::sharedPot;
+SandySoilMix DesertFactory::sharedSoil;
+
+Pot* DesertFactory::pot() 
 {
-	return new TerracottaPot();
+	return &sharedPot;
 }
 
-SoilMix* DesertFactory::createSoilMix() 
+SoilMix* DesertFactory::soilMix() 
 {
-	return new SandySoilMix();
+	return &sharedSoil;
 }
 
 CareStrategy* DesertFactory::careStrategy()
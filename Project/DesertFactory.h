@@ -29,6 +29,12 @@ class DesertFactory : public PlantKitFactory
     /// Static instance of the DesertStrategy (can be used as singleton).
     static DesertStrategy s;
 
+    /// Pot shared by every desert plant (Flyweight).
+    static TerracottaPot sharedPot;
+
+    /// Soil mix shared by every desert plant (Flyweight).
+    static SandySoilMix sharedSoil;
+
 public:
 
     /**
@@ -40,16 +46,16 @@ public:
 protected:
 
     /**
-     * @brief Creates a desert-appropriate pot.
-     * @return Pointer to a Pot instance (TerracottaPot).
+     * @brief Returns the shared desert-appropriate pot.
+     * @return Pointer to the shared Pot (TerracottaPot).
      */
-    Pot* createPot() override;
+    Pot* pot() override;
 
     /**
-     * @brief Creates a desert-appropriate soil mix.
-     * @return Pointer to a SoilMix instance (SandySoilMix).
+     * @brief Returns the shared desert-appropriate soil mix.
+     * @return Pointer to the shared SoilMix (SandySoilMix).
      */
-    SoilMix* createSoilMix() override;
+    SoilMix* soilMix() override;
 };
 
 #endif
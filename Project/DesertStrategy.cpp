@@ -30,7 +30,7 @@ void DesertStrategy::water(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
     
-    int add = static_cast<int>(10 + ((1.0 - species->getWaterSensitivity()) * 10));
+    int add = static_cast<int>(10 + ((1.0 - species->getTraits().waterSensitivity) * 10));
     const int before = plant.getMoisture();
     const int projected = before + add;
     if (projected > 100)
@@ -55,7 +55,7 @@ void DesertStrategy::fertilize(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
     
-    int healthBoost = 3 + static_cast<int>(species->getGrowthRate() * 4);
+    int healthBoost = 3 + static_cast<int>(species->getTraits().growthRate * 4);
     if (plant.getHealth() < 60) 
     {
         plant.addHealth(healthBoost);
@@ -77,7 +77,7 @@ void DesertStrategy::sprayInsecticide(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
     
-    int add = 12 + static_cast<int>(species->getInsecticideTolerance() * 8);
+    int add = 12 + static_cast<int>(species->getTraits().insecticideTolerance * 8);
     const int before = plant.getInsecticide();
     const int projected = before + add;
     if (projected > 100)
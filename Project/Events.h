@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 #include <optional>
+#include "PlantId.h"
 
 /**
 * @namespace events
@@ -51,7 +52,7 @@ namespace events
     struct OrderLine
     {
         /** @brief The unique ID of the specific plant being ordered (if applicable). */
-        std::string plantId;
+        PlantId plantId;
         /** @brief The Stock Keeping Unit (SKU) for the species. */
         std::string speciesSku;
         /** @brief A short description of the line item. */
@@ -94,10 +95,12 @@ namespace events
      */
     struct Plant 
     { 
-        std::string plantId; 
+        PlantId plantId; 
         std::string sku;
         /** @brief The type of plant status change/event being reported. */
         PlantType type;
+        /** @brief The species' index in the SkuTable, when the sender knows it. */
+        SpeciesIndex species = kNoSpecies;
     };
 }
 
@@ -20,6 +20,7 @@
 #include <QSet>
 #include <QListWidget>
 #include <QComboBox>
+#include <QInputDialog>
 #include <random>
 #include <algorithm>
 
@@ -262,6 +263,9 @@ SimpleCustomerWindow::SimpleCustomerWindow(NurseryFacade* f, QString uid, QWidge
         tblEncyclopedia->setSelectionMode(QAbstractItemView::ExtendedSelection);
         tblEncyclopedia->setEditTriggers(QAbstractItemView::NoEditTriggers);
         layout->addWidget(tblEncyclopedia);
+
+        btnBuyQuantity = new QPushButton("Buy Quantity...", this);
+        layout->addWidget(btnBuyQuantity);
     }
     
     tabs->addTab(tabCatalog, tr("Catalog"));
@@ -369,6 +373,58 @@ SimpleCustomerWindow::SimpleCustomerWindow(NurseryFacade* f, QString uid, QWidge
         }
     });
 
+    connect(btnBuyQuantity, &QPushButton::clicked, this, [this]() 
+    {
+        if (!facade) 
+        {
+            QMessageBox::warning(this, "Error", "No facade connected.");
+            return;
+        }
+
+        if (!tblEncyclopedia->selectionModel() || tblEncyclopedia->selectionModel()->selectedRows().isEmpty()) 
+        {
+            QMessageBox::information(this, "No Selection", "Please select a species in the encyclopedia first.");
+            return;
+        }
+
+        const int row = tblEncyclopedia->selectionModel()->selectedRows().first().row();
+        const QString species = mEncyclopedia->item(row, 0)->text();
+        const QString sku = mEncyclopedia->item(row, 0)->data(Qt::UserRole).toString();
+        // The encyclopedia shows the species cost only; the facade quotes what checkout charges.
+        const double price = facade->getSkuPrice(sku.toStdString());
+
+        bool ok = false;
+        const int quantity = QInputDialog::getInt(this, "Buy Quantity", QString("How many %1?").arg(species), 1, 1, 1000, 1, &ok);
+        if (!ok) return;
+
+        const double payment = QInputDialog::getDouble(this, "Payment",
+            QString("Estimated total: R%1\nEnter payment amount:").arg(price * quantity, 0, 'f', 2), price * quantity, 0, 1e9, 2, &ok);
+        if (!ok) return;
+
+        // Plants are picked from the species' stock by the backend; no catalog listing is needed.
+        auto receipt = facade->checkoutBySku(userId.toStdString(), sku.toStdString(), quantity, payment);
+        if (receipt.success) 
+        {
+            QMessageBox::information(this, "Receipt", QString(
+                "✓ Payment Successful!\n\n"
+                "Order ID: %1\n"
+                "Total: R%2\n"
+                "Paid: R%3\n"
+                "Change: R%4"
+            ).arg(QString::fromStdString(receipt.orderId))
+             .arg(receipt.totalCost, 0, 'f', 2)
+             .arg(receipt.amountPaid, 0, 'f', 2)
+             .arg(receipt.change, 0, 'f', 2));
+
+            populateCatalog();
+            refreshMyOrders();
+        } 
+        else 
+        {
+            QMessageBox::critical(this, "Payment Failed", QString::fromStdString(receipt.message));
+        }
+    });
+
     connect(btnRemoveFromCart, &QPushButton::clicked, this, [this]()
     {
         if (!tblCart->selectionModel()) return;
@@ -443,14 +499,15 @@ SimpleCustomerWindow::SimpleCustomerWindow(NurseryFacade* f, QString uid, QWidge
         for (int r = 0; r < mCart->rowCount(); ++r) 
         {
             events::OrderLine line;
-            line.plantId     = mCart->item(r, 0)->data(Qt::UserRole).toString().toStdString();
+            line.plantId     = PlantId::find(mCart->item(r, 0)->data(Qt::UserRole).toString().toStdString());
             line.speciesSku  = mCart->item(r, 0)->data(Qt::UserRole + 2).toString().toStdString();
             line.description = mCart->item(r, 0)->text().toStdString();
             line.finalCost   = mCart->item(r, 2)->data(Qt::UserRole + 1).toDouble();
             lines.push_back(std::move(line));
         }
         
-        auto receipt = facade->checkout(userId.toStdString(), lines, payment);
+        // The cart is paid as a whole, so fail rather than silently dropping sold-out lines.
+        auto receipt = facade->checkout(userId.toStdString(), lines, payment, true);
         
         if (receipt.success) 
         {
@@ -590,6 +647,11 @@ void SimpleCustomerWindow::refreshAlerts()
 void SimpleCustomerWindow::populateCatalog()
 {
     if (!facade) return;
+
+    // The refresh timer fires every few seconds; redraw only when the available plants changed.
+    const std::uint64_t generation = facade->availableGeneration();
+    if (generation == catalogGeneration) return;
+    catalogGeneration = generation;
     
     QSet<QString> selectedIds;
     if (tblCatalog->selectionModel()) 
@@ -605,10 +667,10 @@ void SimpleCustomerWindow::populateCatalog()
     
     mCatalog->removeRows(0, mCatalog->rowCount());
     
-    auto plants = facade->browseAvailable();
+    PlantSnapshot plants = facade->availableSnapshot();
     QSet<QString> availablePlantIds; 
     
-    for (Plant* p : plants) 
+    for (Plant* p : *plants) 
     {
         if (!p) continue;
         
@@ -734,7 +796,7 @@ void SimpleCustomerWindow::refreshMyOrders()
         {
             QString desc = QString::fromStdString(l.description);
             QString cost = QString("R%1").arg(l.finalCost, 0, 'f', 2);
-            QString plantId = QString::fromStdString(l.plantId);
+            QString plantId = QString::fromStdString(l.plantId.str());
 
             QList<QStandardItem*> subRow;
             subRow << new QStandardItem(" • " + plantId + " — " + desc)
@@ -888,8 +950,11 @@ void SimpleCustomerWindow::populateEncyclopedia()
         const QString growth = toBand(fw->getGrowthRate());
         const double price = static_cast<double>(fw->getCost());
 
+        auto nameItem = new QStandardItem(name);
+        nameItem->setData(QString::fromStdString(fw->getSku()), Qt::UserRole);
+
         QList<QStandardItem*> row;
-        row << new QStandardItem(name)
+        row << nameItem
             << new QStandardItem(biome)
             << new QStandardItem(season)
             << new QStandardItem(water)
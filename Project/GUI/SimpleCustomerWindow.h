@@ -84,6 +84,7 @@ private:
     QLineEdit* searchBox;                   ///< Search input for filtering catalog
     QTableView* tblCatalog;                 ///< Table displaying available plants
     QStandardItemModel* mCatalog;           ///< Model for catalog table
+    std::uint64_t catalogGeneration = 0;    ///< Availability generation the catalog was last drawn from; 0 before the first draw
     
     QTableView* tblCart;                    ///< Table displaying shopping cart
     QStandardItemModel* mCart;              ///< Model for cart table
@@ -109,6 +110,7 @@ private:
     
     QTableView* tblEncyclopedia = nullptr;  ///< Table for plant encyclopedia
     QStandardItemModel* mEncyclopedia = nullptr; ///< Model for encyclopedia table
+    QPushButton* btnBuyQuantity = nullptr;  ///< Button to buy a quantity of the selected species
     
     /**
      * @brief Populate the encyclopedia with all species information
@@ -563,7 +563,7 @@ void SimpleStaffWindow::refreshMyOrders()
         {
             QString desc = QString::fromStdString(l.description);
             QString cost = QString("R%1").arg(l.finalCost, 0, 'f', 2);
-            QString plantId = QString::fromStdString(l.plantId);
+            QString plantId = QString::fromStdString(l.plantId.str());
             
             QList<QStandardItem*> subRow;
             subRow << new QStandardItem(" • " + plantId + " — " + desc)
@@ -24,6 +24,7 @@
 #include "../CustomerDash.h"
 #include "../StaffDash.h"
 #include <QTimer>
+#include <iostream>
 
 
 int main(int argc, char** argv) 
@@ -34,6 +35,10 @@ int main(int argc, char** argv)
     PlantRegistry protos;
     Greenhouse greenhouse(&protos);
     Inventory store;
+    if (!store.openArchive("inventory_archive.log"))
+    {
+        std::cerr << "Failed to open inventory archive: inventory_archive.log\n";
+    }
     InventoryService inv(store, greenhouse);
     
     CustomerDash customerDash;
@@ -142,7 +147,7 @@ int main(int argc, char** argv)
     for (size_t i = 0; i < species.size(); ++i) 
     {
         std::string sku = std::get<0>(species[i]);
-        std::string id = sku + "#S" + std::to_string(i+1);
+        PlantId id(sku + "#S" + std::to_string(i+1));
         std::string colour = colors[i % colors.size()];
 
         Plant* clone = protos.clone(sku, id, colour);
@@ -155,7 +160,7 @@ int main(int argc, char** argv)
     for (size_t i = 0; i < species.size(); ++i) 
     {
         std::string sku = std::get<0>(species[i]);
-        std::string id = sku + "#G" + std::to_string(i+1);
+        PlantId id(sku + "#G" + std::to_string(i+1));
         std::string colour = colors[(i + 1) % colors.size()];  
 
         Plant* clone = protos.clone(sku, id, colour);
@@ -168,7 +173,7 @@ int main(int argc, char** argv)
     for (size_t i = 0; i < species.size(); ++i) 
     {
         std::string sku = std::get<0>(species[i]);
-        std::string id = sku + "#M" + std::to_string(i+1);
+        PlantId id(sku + "#M" + std::to_string(i+1));
         std::string colour = colors[(i + 2) % colors.size()]; 
 
         Plant* clone = protos.clone(sku, id, colour);
@@ -1,6 +1,7 @@
 #include "Greenhouse.h"
-#include <sstream>
 #include <memory>
+#include <algorithm>
+#include <iostream>
 #include "WiltingState.h"
 #include "Iterator.h"
 #include "GreenhouseIterator.h"
@@ -10,33 +11,63 @@
 
 Greenhouse::Greenhouse(PlantRegistry* p) : proto(p) {}
 
-void Greenhouse::receiveShipment(std::string speciesSku, int batch) 
+void Greenhouse::receiveShipment(std::string speciesSku, int batch, std::vector<PlantId>* added) 
 {
     if (batch <= 0) return;
 
-    for (int i = 0; i < batch; ++i) 
+    // Ids and arena space claimed for a SKU that cannot be cloned could never be handed back.
+    const SpeciesIndex species = SkuTable::find(speciesSku);
+    if (!proto || !proto->canClone(species))
     {
-      std::string colour = pickColour(i);
-      std::string id = nextIdFor(speciesSku);  
-      Plant* clone = proto->clone(speciesSku, id, colour);  
-      if (clone) 
-      {
-          plantInstances.emplace(id, std::unique_ptr<Plant>(clone));
-          plantToSku.emplace(id, speciesSku);
-      }
+        std::cerr << "SKU not found\n";
+        return;
     }
 
+    PlantIdRange ids = idGenerator.reserve(species, static_cast<std::uint32_t>(batch));
+
+    // One prototype lookup and one growth of every container for the whole batch.
+    PlantArena::Scope scope(arena, static_cast<std::size_t>(batch));
+    shipment.clear();
+    proto->cloneBatch(ids, shipment, colourPalette());
+
+    // Containers are grown at least geometrically, so a stream of small shipments stays amortised.
+    const std::size_t plants = plantInstances.size() + shipment.size();
+    if (plants > plantInstances.bucket_count() * plantInstances.max_load_factor())
+        plantInstances.reserve(std::max(plants, 2 * plantInstances.size()));
+    store.reserve(shipment.size());
+    if (slotsBySku.size() <= species) slotsBySku.resize(species + 1);
+    std::vector<std::uint32_t>& skuSlots = slotsBySku[species];
+    if (skuSlots.size() + shipment.size() > skuSlots.capacity())
+        skuSlots.reserve(std::max(skuSlots.size() + shipment.size(), 2 * skuSlots.capacity()));
+
+    if (added) added->reserve(added->size() + shipment.size());
+    for (Plant* clone : shipment)
+    {
+        // An id that is already taken keeps its plant; the clone is dropped.
+        PlantId id = clone->getPlantId();
+        if (!plantInstances.emplace(id, std::unique_ptr<Plant>(clone)).second) continue;
+        indexSku(species, store.attach(clone));
+        if (added) added->push_back(id);
+    }
+    shipment.clear();
+
     events::Stock s{ speciesSku, events::StockType::Added };
     notify(s);
 }
 
-std::string Greenhouse::pickColour(int index) 
+const std::vector<std::string>& Greenhouse::colourPalette()
 {
     static const std::vector<std::string> colours = {"Red","Yellow","Purple","Pink","White","Orange","Blue","Silver","Gold", "Green"};
+    return colours;
+}
+
+std::string Greenhouse::pickColour(int index) 
+{
+    const std::vector<std::string>& colours = colourPalette();
     return colours[index % colours.size()];
 }
 
-Plant* Greenhouse::getPlant(const std::string& plantId)
+Plant* Greenhouse::getPlant(const PlantId& plantId)
 {
   auto it = plantInstances.find(plantId);
   return (it == plantInstances.end()) ? nullptr : it->second.get();
@@ -45,81 +76,147 @@ Plant* Greenhouse::getPlant(const std::string& plantId)
 void Greenhouse::addPlant(std::unique_ptr<Plant> plant)
 {
     if (!plant) return;
-    std::string id = plant->id();
-    std::string sku = plant->sku(); 
-    plantToSku[id] = sku;
+    PlantId id = plant->getPlantId();
+    SpeciesIndex species = SkuTable::intern(plant->sku()); 
+
+    // A plant re-added under an existing id replaces the old one.
+    auto existing = plantInstances.find(id);
+    if (existing != plantInstances.end()) unindexSku(existing->second->getSlot());
+
+    indexSku(species, store.attach(plant.get()));
     plantInstances[id] = std::move(plant);
 }
 
 int Greenhouse::countBySku(const std::string& sku)
 {
-    int count = 0;
-    for (const auto& [id, skuStr] : plantToSku) 
-    {
-        if (skuStr == sku) ++count;
-    }
-    return count;
+    return countBySku(SkuTable::find(sku));
 }
 
-bool Greenhouse::removePlant(const std::string& plantId)
+int Greenhouse::countBySku(SpeciesIndex species) const
+{
+    return species < slotsBySku.size() ? static_cast<int>(slotsBySku[species].size()) : 0;
+}
+
+int Greenhouse::countByState(const PlantState* state) const
+{
+    const std::uint8_t index = PlantStore::indexOf(state);
+    return index < PlantStore::kStateCount ? static_cast<int>(store.slotsInState(index).size()) : 0;
+}
+
+int Greenhouse::getPlantCount() const
+{
+    return static_cast<int>(plantInstances.size());
+}
+
+bool Greenhouse::removePlant(const PlantId& plantId)
 {
     auto it = plantInstances.find(plantId);
     if (it == plantInstances.end()) return false;
   
+    unindexSku(it->second->getSlot());
     plantInstances.erase(it);
-    plantToSku.erase(plantId);
   
     return true;
 }
 
-std::string Greenhouse::nextIdFor(std::string speciesSku) 
+void Greenhouse::indexSku(SpeciesIndex species, std::uint32_t slot)
 {
-    int& n = seqBySku[speciesSku];
-    std::ostringstream os;
-    os << speciesSku << "#" << (++n);
-    return os.str();
+    if (slotsBySku.size() <= species) slotsBySku.resize(species + 1);
+    if (skuPosition.size() <= slot)
+    {
+        skuPosition.resize(slot + 1);
+        slotSpecies.resize(slot + 1, kNoSpecies);
+    }
+    if (skuGeneration.size() <= species) skuGeneration.resize(species + 1, 0);
+    std::vector<std::uint32_t>& slots = slotsBySku[species];
+    skuPosition[slot] = static_cast<std::uint32_t>(slots.size());
+    slotSpecies[slot] = species;
+    slots.push_back(slot);
+    ++skuGeneration[species];
+    ++membership;
 }
- 
+
+/**
+ * @brief Swap-removes a slot from its SKU list, patching the position of the slot moved into its place
+ */
+void Greenhouse::unindexSku(std::uint32_t slot)
+{
+    if (slot >= slotSpecies.size() || slotSpecies[slot] == kNoSpecies) return;
+
+    ++skuGeneration[slotSpecies[slot]];
+    ++membership;
+    std::vector<std::uint32_t>& slots = slotsBySku[slotSpecies[slot]];
+    std::uint32_t pos = skuPosition[slot];
+    slotSpecies[slot] = kNoSpecies;
+    if (pos >= slots.size() || slots[pos] != slot) return;
+
+    slots[pos] = slots.back();
+    skuPosition[slots[pos]] = pos;
+    slots.pop_back();
+}
+
 void Greenhouse::tickAll() 
 {
-    std::vector<std::string> toRemove;
-
-    Iterator* it = createIterator();
-    for (it->first(); !it->isDone(); it->next())
-    { 
-        Plant* plant = it->currentItem();
-        if (!plant) continue;
-        
-        PlantState* before = plant->getPlantState();  
-        std::string beforeName = before->name();
-    
-        plant->getPlantState()->checkChange(*plant);
-        
-        PlantState* after = plant->getPlantState();
-        std::string afterName = after->name();
-        
-        if (before != after) 
-        {  
-            if (after == &MatureState::getInstance()) 
-            {
-                events::Plant e{ plant->id(), plant->sku(), events::PlantType::Matured };
-                notify(e);
-            }
-
-            else if (after == &WiltingState::getInstance())
-            {
-                events::Plant e{ plant->id(), plant->sku(), events::PlantType::Wilted };
-                notify(e);
-            }
-        }
-        if(after == &DeadState::getInstance())
+    // One instant, season and set of maturity thresholds for the whole tick.
+    TickContext context;
+    context.prepareSpecies(store);
+
+    // The lazy tick runs only the awake slots, in slot order so events replay as in a full pass.
+    std::vector<std::uint32_t> awake;
+    if (lazyTick)
+    {
+        store.wakeDue();
+        store.collectAwake(awake);
+    }
+    const std::uint32_t* slotList = lazyTick ? awake.data() : nullptr;
+    const std::uint32_t items = lazyTick ? static_cast<std::uint32_t>(awake.size()) : store.size();
+    const unsigned threads = getTickThreads();
+
+    // Small greenhouses are not worth waking the pool for.
+    const std::uint32_t minShardSlots = 4096;
+    unsigned shards = 1;
+    if (threads > 1 && items >= 2 * minShardSlots)
+    {
+        shards = std::min<unsigned>(threads * 4, items / minShardSlots);
+    }
+
+    std::vector<std::vector<PendingEvent>> buffers(shards);
+    std::vector<std::vector<StateMove>> moves(shards);
+    auto runShard = [&](unsigned s)
+    {
+        std::uint32_t begin = static_cast<std::uint32_t>(static_cast<std::uint64_t>(items) * s / shards);
+        std::uint32_t end = static_cast<std::uint32_t>(static_cast<std::uint64_t>(items) * (s + 1) / shards);
+        tickShard(slotList, begin, end, context, buffers[s], moves[s]);
+    };
+
+    if (shards == 1) runShard(0);
+    else tickPool->run(shards, runShard);
+
+    // The buckets are shared between shards, so they are brought up to date serially.
+    for (const auto& shardMoves : moves)
+    {
+        for (const auto& move : shardMoves) store.moveBucket(move.slot, move.from);
+    }
+    store.advanceTick();
+
+    // Plants that will change in a straight line for a while skip those ticks.
+    for (std::uint32_t slot : awake)
+    {
+        store.sleep(slot, TickKernel::idleTicks(store.stateIndex(slot), store.moistureData()[slot],
+                                                store.healthData()[slot], store.insecticideData()[slot]));
+    }
+
+    std::vector<PlantId> toRemove;
+    for (const auto& buffer : buffers)
+    {
+        for (const auto& pending : buffer)
         {
-            events::Plant e{ plant->id(), plant->sku(), events::PlantType::Died };
+            Plant* plant = store.plantAt(pending.slot);
+            events::Plant e{ plant->getPlantId(), plant->sku(), pending.type, slotSpecies[pending.slot] };
             notify(e);
-            toRemove.push_back(plant->id());
+            if (pending.type == events::PlantType::Died) toRemove.push_back(e.plantId);
         }
     }
-    delete it;
 
     for (const auto& deadId : toRemove) 
     {
@@ -127,35 +224,221 @@ void Greenhouse::tickAll()
     }
 }
 
-Iterator* Greenhouse::createIterator() const 
+/**
+ * @brief Ticks one shard with the batch kernel and turns state changes into events
+ *
+ * A contiguous shard is ticked in place. A shard of the lazy tick's slot list is gathered into
+ * scratch columns first and scattered back afterwards. The kernel applies the same rules as the
+ * PlantState classes; the states before the run are kept so Matured/Wilted are reported only on
+ * an actual change, while Died is reported for every dead plant, as before.
+ */
+void Greenhouse::tickShard(const std::uint32_t* slots, std::uint32_t begin, std::uint32_t end, const TickContext& context,
+                           std::vector<PendingEvent>& out, std::vector<StateMove>& moves)
 {
-    std::vector<Plant*> snapshot;
-    snapshot.reserve(plantInstances.size());
-    for (auto& kv : const_cast<Greenhouse*>(this)->plantInstances) 
+    if (begin >= end) return;
+    const std::uint32_t count = end - begin;
+    auto slotOf = [&](std::uint32_t i) { return slots ? slots[begin + i] : begin + i; };
+
+    TickKernel::Batch batch;
+    std::vector<std::int32_t> moisture, health, insecticide;
+    std::vector<std::uint8_t> gathered;
+    std::vector<std::uint16_t> species;
+    if (slots)
+    {
+        moisture.resize(count);
+        health.resize(count);
+        insecticide.resize(count);
+        gathered.resize(count);
+        species.resize(count);
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            const std::uint32_t slot = slotOf(i);
+            moisture[i] = store.moistureData()[slot];
+            health[i] = store.healthData()[slot];
+            insecticide[i] = store.insecticideData()[slot];
+            gathered[i] = store.stateIndex(slot);
+            species[i] = store.speciesIndex(slot);
+        }
+        batch.moisture = moisture.data();
+        batch.health = health.data();
+        batch.insecticide = insecticide.data();
+        batch.state = gathered.data();
+        batch.species = species.data();
+    }
+    else
+    {
+        batch.moisture = store.moistureData() + begin;
+        batch.health = store.healthData() + begin;
+        batch.insecticide = store.insecticideData() + begin;
+        batch.state = store.stateData() + begin;
+        batch.species = store.speciesData() + begin;
+    }
+
+    std::vector<std::uint8_t> before(batch.state, batch.state + count);
+    std::vector<std::int32_t> ages(count, 0);
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        // Only Seedling and Growing plants compare their age against a threshold.
+        if (before[i] <= 1) ages[i] = context.ageDays(store.createdAt(slotOf(i)));
+    }
+
+    batch.ageDays = ages.data();
+    batch.seedlingAgeLimit = context.seedlingAgeLimits();
+    batch.growingAgeLimit = context.growingAgeLimits();
+    batch.count = count;
+    TickKernel::run(batch);
+
+    if (slots)
     {
-        snapshot.push_back(kv.second.get());
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            const std::uint32_t slot = slotOf(i);
+            store.moistureData()[slot] = moisture[i];
+            store.healthData()[slot] = health[i];
+            store.insecticideData()[slot] = insecticide[i];
+            store.stateData()[slot] = gathered[i];
+        }
     }
-    return new GreenhouseIterator(snapshot);
+
+    const std::uint8_t mature = PlantStore::indexOf(&MatureState::getInstance());
+    const std::uint8_t wilting = PlantStore::indexOf(&WiltingState::getInstance());
+    const std::uint8_t dead = PlantStore::indexOf(&DeadState::getInstance());
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        const std::uint8_t after = batch.state[i];
+        if (after == PlantStore::kVacant) continue;
+
+        const std::uint32_t slot = slotOf(i);
+        if (before[i] != after)
+        {
+            moves.push_back({ slot, before[i] });
+            if (after == mature) out.push_back({ slot, events::PlantType::Matured });
+            else if (after == wilting) out.push_back({ slot, events::PlantType::Wilted });
+        }
+        if (after == dead) out.push_back({ slot, events::PlantType::Died });
+    }
+}
+
+void Greenhouse::setLazyTick(bool lazy)
+{
+    if (!lazy) store.wakeAll();
+    lazyTick = lazy;
+}
+
+bool Greenhouse::isLazyTick() const
+{
+    return lazyTick;
+}
+
+std::uint32_t Greenhouse::getSleepingCount() const
+{
+    return store.sleepingCount();
+}
+
+void Greenhouse::setTickThreads(unsigned threads)
+{
+    if (threads <= 1) tickPool.reset();
+    else if (!tickPool || tickPool->participants() != threads) tickPool = std::make_unique<TickWorkerPool>(threads);
 }
 
-Iterator* Greenhouse::createStateIterator(const PlantState* state) const 
+unsigned Greenhouse::getTickThreads() const
 {
-    std::vector<Plant*> snapshot;
-    snapshot.reserve(plantInstances.size());
-    for (auto& kv : const_cast<Greenhouse*>(this)->plantInstances) 
+    return tickPool ? tickPool->participants() : 1;
+}
+
+std::unique_ptr<Iterator> Greenhouse::createIterator() const 
+{
+    return std::make_unique<GreenhouseIterator>(snapshot());
+}
+
+std::unique_ptr<Iterator> Greenhouse::createStateIterator(const PlantState* state) const 
+{
+    return std::make_unique<StateIterator>(stateSnapshot(state), state);
+}
+
+std::unique_ptr<Iterator> Greenhouse::createSkuIterator(const std::string& sku) const 
+{
+    return createSkuIterator(SkuTable::find(sku));
+}
+
+std::unique_ptr<Iterator> Greenhouse::createSkuIterator(SpeciesIndex species) const 
+{
+    return std::make_unique<SkuIterator>(skuSnapshot(species));
+}
+
+/**
+ * @brief Builds a new list only when the generation moved on; iterators holding the old one keep it
+ */
+template <typename Build>
+PlantSnapshot Greenhouse::refresh(SnapshotCache& cache, std::uint64_t generation, Build build)
+{
+    if (!cache.plants || cache.generation != generation)
     {
-        snapshot.push_back(kv.second.get());
+        auto plants = std::make_shared<std::vector<Plant*>>();
+        build(*plants);
+        cache.plants = std::move(plants);
+        cache.generation = generation;
     }
-    return new StateIterator(snapshot, state);
+    return cache.plants;
 }
 
-Iterator* Greenhouse::createSkuIterator(const std::string& sku) const 
+PlantSnapshot Greenhouse::snapshot() const
 {
-    std::vector<Plant*> snapshot;
-    snapshot.reserve(plantInstances.size());
-    for (auto& kv : const_cast<Greenhouse*>(this)->plantInstances) 
+    return refresh(allCache, membership, [this](std::vector<Plant*>& out)
     {
-        snapshot.push_back(kv.second.get());
-    }
-    return new SkuIterator(snapshot, sku);
+        out.reserve(plantInstances.size());
+        for (const auto& kv : plantInstances) out.push_back(kv.second.get());
+    });
+}
+
+PlantSnapshot Greenhouse::stateSnapshot(const PlantState* state) const
+{
+    const std::uint8_t index = PlantStore::indexOf(state);
+    if (index >= PlantStore::kStateCount) return std::make_shared<const std::vector<Plant*>>();
+    return refresh(stateCache[index], store.bucketGeneration(index), [this, index](std::vector<Plant*>& out)
+    {
+        const std::vector<std::uint32_t>& slots = store.slotsInState(index);
+        out.reserve(slots.size());
+        for (std::uint32_t slot : slots) out.push_back(store.plantAt(slot));
+    });
+}
+
+PlantSnapshot Greenhouse::skuSnapshot(SpeciesIndex species) const
+{
+    if (species >= slotsBySku.size()) return std::make_shared<const std::vector<Plant*>>();
+    if (skuCache.size() <= species) skuCache.resize(species + 1);
+    return refresh(skuCache[species], skuGeneration[species], [this, species](std::vector<Plant*>& out)
+    {
+        out.reserve(slotsBySku[species].size());
+        for (std::uint32_t slot : slotsBySku[species]) out.push_back(store.plantAt(slot));
+    });
+}
+
+Greenhouse::AllPlantRange Greenhouse::plants() const
+{
+    Plant* const* owners = store.ownerData();
+    Plant* const* last = owners + store.size();
+    return AllPlantRange(OccupiedPlantIterator(owners, last), OccupiedPlantIterator(last, last));
+}
+
+Greenhouse::SlotPlantRange Greenhouse::plantsInState(const PlantState* state) const
+{
+    const std::uint8_t index = PlantStore::indexOf(state);
+    if (index >= PlantStore::kStateCount) return SlotPlantRange(SlotPlantIterator(), SlotPlantIterator());
+    const std::vector<std::uint32_t>& slots = store.slotsInState(index);
+    return SlotPlantRange(SlotPlantIterator(slots.data(), store.ownerData()),
+                          SlotPlantIterator(slots.data() + slots.size(), store.ownerData()));
+}
+
+Greenhouse::SlotPlantRange Greenhouse::plantsOfSku(const std::string& sku) const
+{
+    return plantsOfSku(SkuTable::find(sku));
+}
+
+Greenhouse::SlotPlantRange Greenhouse::plantsOfSku(SpeciesIndex species) const
+{
+    if (species >= slotsBySku.size()) return SlotPlantRange(SlotPlantIterator(), SlotPlantIterator());
+    const std::vector<std::uint32_t>& slots = slotsBySku[species];
+    return SlotPlantRange(SlotPlantIterator(slots.data(), store.ownerData()),
+                          SlotPlantIterator(slots.data() + slots.size(), store.ownerData()));
 }
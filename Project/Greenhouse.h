@@ -19,11 +19,18 @@
 #include "SeedlingState.h"
 #include "GrowingState.h"
 #include "Plant.h"
+#include "PlantStore.h"
+#include "PlantArena.h"
+#include "PlantSnapshot.h"
+#include "PlantRange.h"
+#include "Iterator.h"
+#include "TickWorkerPool.h"
+#include "TickKernel.h"
+#include "TickContext.h"
 #include <memory>
 #include "SpeciesCatalog.h"
 
 // Forward declarations for external dependencies
-class Iterator;
 class PlantState;
 
 /**
@@ -52,11 +59,15 @@ public:
   	/**
      * @brief Receives a batch of new plants for a given species SKU, generates unique IDs,
      * and adds them to the greenhouse collection.
+     * The plants are cloned in one PlantRegistry::cloneBatch() call and the containers are
+     * grown once for the whole batch. A SKU without a registered prototype is reported and
+     * nothing is allocated for it: no ids, no arena space.
      * @param speciesSku The SKU of the plant species being received.
      * @param batch The number of new plants to add.
+     * @param added If not null, receives the ids of the plants actually added, in order.
      */
 
-  	void receiveShipment(std::string speciesSku, int batch);
+  	void receiveShipment(std::string speciesSku, int batch, std::vector<PlantId>* added = nullptr);
 
 	/**
      * @brief Adds an already constructed Plant instance to the greenhouse's managed collection.
@@ -79,86 +90,406 @@ public:
      * @return A raw pointer to the requested Plant instance, or nullptr if not present.
      */
 
-	Plant* getPlant(const std::string& plantId);
+	Plant* getPlant(const PlantId& plantId);
 
 	/**
      * @brief Counts how many plants of a particular species SKU currently exist in the greenhouse.
+     * Answered from the per-SKU index in constant time.
      * @param sku The species Stock Keeping Unit (SKU) to count.
      * @return The total number of plants matching the SKU.
      */
 
 	int countBySku(const std::string& sku);
 
+	/**
+     * @brief Counts how many plants of an interned species currently exist in the greenhouse.
+     * @param species The species' index in the SkuTable.
+     * @return The total number of plants of that species.
+     */
+
+	int countBySku(SpeciesIndex species) const;
+
+	/**
+     * @brief Counts how many plants are currently in a lifecycle state.
+     * Answered from the store's per-state bucket in constant time.
+     * @param state A pointer to the PlantState singleton to count.
+     * @return The number of plants in that state.
+     */
+
+	int countByState(const PlantState* state) const;
+
+	/**
+     * @brief Counts every plant in the greenhouse.
+     * @return The number of plants.
+     */
+
+	int getPlantCount() const;
+
 	/**
      * @brief Removes a plant from the greenhouse's managed collection (e.g., after being sold or dying).
      * @param plantId The unique identifier of the plant to remove.
      * @return true if the plant was successfully found and removed, false otherwise.
      */
 
-	bool removePlant(const std::string& plantId);
+	bool removePlant(const PlantId& plantId);
 
 	/**
      * @brief Advances the state/simulation time for all plants.
      *
-     * This method iterates over all managed plants and calls an update/tick method on them,
-     * potentially triggering state changes (e.g., from SeedlingState to GrowingState).
+     * This method walks the columnar plant store slot by slot and calls an update/tick method
+     * on each plant, potentially triggering state changes (e.g., from SeedlingState to GrowingState).
      */
 
 	
 	void tickAll();
 
+	/**
+     * @brief Sets how many threads tickAll() may use.
+     *
+     * With more than one thread the plant store is split into contiguous shards that are
+     * ticked in parallel. Each shard buffers its state-transition events, and the buffers are
+     * replayed to observers in slot order afterwards, so observers see exactly the sequence
+     * the single-threaded tick produces.
+     *
+     * @param threads Number of threads including the caller; 0 or 1 ticks serially.
+     */
+
+	void setTickThreads(unsigned threads);
+
+	/**
+     * @brief Returns how many threads tickAll() uses.
+     * @return The configured thread count (at least 1).
+     */
+
+	unsigned getTickThreads() const;
+
+	/**
+     * @brief Switches between full and lazy ticking.
+     *
+     * A lazy tick only runs the plants whose state can change. A Mature plant that will change
+     * in a straight line for the next ticks (see TickKernel::idleTicks()) sleeps in a timing
+     * wheel until it is due. Its values are worked out when they are read, and it wakes early
+     * if it is cared for or its state is set. Results and events are identical to full ticking.
+     *
+     * @param lazy true to tick lazily; false wakes every sleeping plant and ticks every slot.
+     */
+
+	void setLazyTick(bool lazy);
+
+	/**
+     * @brief Returns whether tickAll() ticks lazily.
+     * @return true if lazy ticking is on.
+     */
+
+	bool isLazyTick() const;
+
+	/**
+     * @brief Returns how many plants the lazy tick is currently skipping.
+     * @return The number of sleeping plants (0 when ticking fully).
+     */
+
+	std::uint32_t getSleepingCount() const;
+
 	/**
      * @brief Factory method to create an Iterator that traverses all plants in the greenhouse.
-     * @return A pointer to a newly created concrete Iterator object.
+     * The iterator shares snapshot(), so creating one copies no plant list.
+     * @return The newly created concrete Iterator object.
      */
 
-	Iterator* createIterator() const;
+	std::unique_ptr<Iterator> createIterator() const;
 	
 	/**
      * @brief Factory method to create an Iterator that traverses only plants in a specific state.
+     * Only the plants in that state are visited, via the shared stateSnapshot().
      * @param state A pointer to the target PlantState object.
-     * @return A pointer to a newly created concrete Iterator object.
+     * @return The newly created concrete Iterator object.
      */
 
-	Iterator* createStateIterator(const PlantState* state) const;
+	std::unique_ptr<Iterator> createStateIterator(const PlantState* state) const;
 	
 	/**
      * @brief Factory method to create an Iterator that traverses only plants of a specific SKU.
+     * Only the matching plants are visited, via the shared skuSnapshot().
      * @param sku The Stock Keeping Unit (SKU) to filter the plants by.
-     * @return A pointer to a newly created concrete Iterator object.
+     * @return The newly created concrete Iterator object.
+     */
+
+	std::unique_ptr<Iterator> createSkuIterator(const std::string& sku) const;
+
+	/**
+     * @brief Factory method to create an Iterator over the plants of an interned species.
+     * @param species The species' index in the SkuTable.
+     * @return The newly created concrete Iterator object.
+     */
+
+	std::unique_ptr<Iterator> createSkuIterator(SpeciesIndex species) const;
+
+	/**
+     * @brief Returns the current generation of the whole plant set.
+     * The list is built on the first call after plants were added or removed; until then every
+     * call returns the same snapshot.
+     * @return The snapshot of every plant in the greenhouse.
+     */
+
+	PlantSnapshot snapshot() const;
+
+	/**
+     * @brief Returns the generation of the whole plant set.
+     * Moves on whenever a plant is added to or removed from the greenhouse; state changes do not
+     * move it.
+     * @return The current generation.
+     */
+
+	std::uint64_t membershipGeneration() const { return membership; }
+
+	/**
+     * @brief Returns the current generation of the plants in a lifecycle state.
+     * Rebuilt only after a plant entered or left the state's bucket.
+     * @param state A pointer to the PlantState singleton.
+     * @return The snapshot of the plants in that state; empty for an unknown state.
+     */
+
+	PlantSnapshot stateSnapshot(const PlantState* state) const;
+
+	/**
+     * @brief Returns the current generation of the plants of an interned species.
+     * Rebuilt only after a plant of that species was added or removed.
+     * @param species The species' index in the SkuTable.
+     * @return The snapshot of the plants of that species; empty for an unknown species.
+     */
+
+	PlantSnapshot skuSnapshot(SpeciesIndex species) const;
+
+	/**
+     * @brief Range over the plants of a list of store slots (a state bucket or a species' index).
+     */
+
+	using SlotPlantRange = PlantRange<SlotPlantIterator>;
+
+	/**
+     * @brief Range over every plant, in store slot order.
+     */
+
+	using AllPlantRange = PlantRange<OccupiedPlantIterator>;
+
+	/**
+     * @brief Returns a view of every plant in the greenhouse.
+     * The view walks the store directly: no list is built and nothing is allocated.
+     * @return The range, in slot order; invalidated when plants are added or removed.
+     */
+
+	AllPlantRange plants() const;
+
+	/**
+     * @brief Returns a view of the plants in a lifecycle state, read from the store's state bucket.
+     * @param state A pointer to the PlantState singleton.
+     * @return The range; empty for an unknown state. Invalidated when any plant changes state.
+     */
+
+	SlotPlantRange plantsInState(const PlantState* state) const;
+
+	/**
+     * @brief Returns a view of the plants of a species SKU, read from the per-SKU index.
+     * @param sku The Stock Keeping Unit (SKU).
+     * @return The range; empty for an unknown SKU. Invalidated when plants are added or removed.
+     */
+
+	SlotPlantRange plantsOfSku(const std::string& sku) const;
+
+	/**
+     * @brief Returns a view of the plants of an interned species.
+     * @param species The species' index in the SkuTable.
+     * @return The range; empty for an unknown species.
+     */
+
+	SlotPlantRange plantsOfSku(SpeciesIndex species) const;
+
+	/**
+     * @brief Returns the arena the plants of receiveShipment() are allocated from.
+     * @return The greenhouse's PlantArena.
      */
 
-	Iterator* createSkuIterator(const std::string& sku) const;
+	const PlantArena& getArena() const { return arena; }
 
 private:
 
 	/**
-     * @brief Maps a unique plant ID to its corresponding species SKU.
+     * @brief Slab pool for the plants created by receiveShipment().
+     * Declared before store and plantInstances so it outlives every plant allocated from it.
+     */
+
+	PlantArena arena;
+
+	/**
+     * @brief Columnar store holding the hot attributes of every plant in the greenhouse.
+     * Declared before plantInstances so it outlives the plants that view it.
+     */
+
+	PlantStore store;
+
+	/**
+     * @brief Species each occupied slot was indexed under, indexed by slot.
      */
 
-	std::unordered_map<std::string, std::string> plantToSku;
+	std::vector<SpeciesIndex> slotSpecies;
+
+	/**
+     * @brief Live index from SpeciesIndex to the store slots of its plants, in no particular order.
+     * Kept in step by receiveShipment(), addPlant() and removePlant().
+     */
+
+	std::vector<std::vector<std::uint32_t>> slotsBySku;
+
+	/**
+     * @brief Position of each slot inside its species' list in slotsBySku, indexed by slot.
+     */
+
+	std::vector<std::uint32_t> skuPosition;
+
+	/**
+     * @brief Adds a store slot to the SKU index.
+     * @param species The species of the plant in the slot.
+     * @param slot The slot the plant was attached to.
+     */
+
+	void indexSku(SpeciesIndex species, std::uint32_t slot);
+
+	/**
+     * @brief Removes a store slot from the SKU index in constant time.
+     * @param slot The slot being vacated.
+     */
+
+	void unindexSku(std::uint32_t slot);
+
+	/**
+     * @brief Generation of the whole plant set, bumped whenever the SKU index changes.
+     */
+
+	std::uint64_t membership = 0;
+
+	/**
+     * @brief Generation of each species' plant set, indexed by SpeciesIndex.
+     */
+
+	std::vector<std::uint64_t> skuGeneration;
+
+	/**
+     * @brief A snapshot handed out by the Greenhouse and the generation it was built from.
+     */
+
+	struct SnapshotCache
+	{
+		/** @brief The shared list; null until first built. */
+		PlantSnapshot plants;
+		/** @brief Generation the list reflects. */
+		std::uint64_t generation = 0;
+	};
+
+	/**
+     * @brief Rebuilds a cached snapshot if its generation is out of date.
+     * @param cache The cache entry.
+     * @param generation The current generation of the set it caches.
+     * @param build Fills the new list.
+     * @return The up-to-date snapshot.
+     */
+
+	template <typename Build>
+	static PlantSnapshot refresh(SnapshotCache& cache, std::uint64_t generation, Build build);
+
+	/**
+     * @brief Snapshot of every plant, built by snapshot().
+     */
+
+	mutable SnapshotCache allCache;
+
+	/**
+     * @brief Snapshot of each state bucket, built by stateSnapshot() and indexed by state index.
+     */
+
+	mutable SnapshotCache stateCache[PlantStore::kStateCount];
+
+	/**
+     * @brief Snapshot of each species' plants, built by skuSnapshot() and indexed by SpeciesIndex.
+     */
+
+	mutable std::vector<SnapshotCache> skuCache;
 
 	/**
      * @brief The main collection of live Plant instances, keyed by their unique plant ID.
      * Plants are managed using unique pointers.
      */
 
-	std::unordered_map<std::string, std::unique_ptr<Plant>> plantInstances;
+	std::unordered_map<PlantId, std::unique_ptr<Plant>> plantInstances;
 
   	/**
-     * @brief Simple counters used to generate sequence numbers for plant IDs per SKU.
-     * E.g., ROSE-STD -> 3 means the next one will be #4.
+     * @brief Per-SKU sequence counters for the ids of received plants.
+     * E.g., ROSE-STD -> 3 means the next one will be #4. Each shipment claims its whole range at once.
      */
 
-  	std::unordered_map<std::string, int> seqBySku;
+  	PlantIdGenerator idGenerator;
 
-  	/**
-     * @brief Helper function to generate the next unique plant ID string based on the species SKU.
-     * @param speciesSku The SKU to generate the ID prefix from.
-     * @return The next unique ID (e.g., "ROSE-STD#4").
+	/**
+     * @brief Returns the colour palette new plants cycle through (see pickColour()).
+     * @return The palette.
+     */
+
+	static const std::vector<std::string>& colourPalette();
+
+	/**
+     * @brief Scratch buffer receiving the clones of a shipment; empty between calls.
+     */
+
+	std::vector<Plant*> shipment;
+
+	/**
+     * @brief A state-transition event recorded by a tick shard before observers are notified.
+     */
+
+	struct PendingEvent
+	{
+		/** @brief Store slot of the plant that changed state. */
+		std::uint32_t slot;
+		/** @brief Kind of transition. */
+		events::PlantType type;
+	};
+
+	/**
+     * @brief A state change made by the tick kernel, applied to the store's state buckets after the shards finish.
+     */
+
+	struct StateMove
+	{
+		/** @brief Store slot of the plant that changed state. */
+		std::uint32_t slot;
+		/** @brief State index before the tick. */
+		std::uint8_t from;
+	};
+
+	/**
+     * @brief Ticks a shard of plants and records their transitions.
+     * Runs TickKernel over the store columns of the shard.
+     * @param slots Sorted slot list of a lazy tick, or nullptr to tick the slot range [begin, end) itself.
+     * @param begin First entry (slot or list index) of the shard.
+     * @param end One past the last entry of the shard.
+     * @param context Frozen time, season and species age limits of the tick.
+     * @param out Buffer receiving the shard's events in slot order.
+     * @param moves Buffer receiving every state change of the shard.
+     */
+
+	void tickShard(const std::uint32_t* slots, std::uint32_t begin, std::uint32_t end, const TickContext& context,
+	               std::vector<PendingEvent>& out, std::vector<StateMove>& moves);
+
+	/**
+     * @brief Worker pool used by tickAll() when more than one tick thread is configured.
+     */
+
+	std::unique_ptr<TickWorkerPool> tickPool;
+
+	/**
+     * @brief Whether tickAll() only runs awake plants (see setLazyTick()).
      */
 
-  	std::string nextIdFor(std::string speciesSku);
+	bool lazyTick = false;
 
 	/**
      * @brief A pointer to the PlantRegistry, used as a prototype source for new plants.
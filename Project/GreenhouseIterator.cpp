@@ -1,6 +1,8 @@
 #include "GreenhouseIterator.h"
 
-GreenhouseIterator::GreenhouseIterator(const std::vector<Plant*>& plants): plants(plants), current(0) {}
+GreenhouseIterator::GreenhouseIterator(const std::vector<Plant*>& plants): plants(std::make_shared<const std::vector<Plant*>>(plants)), current(0) {}
+
+GreenhouseIterator::GreenhouseIterator(PlantSnapshot plants): plants(std::move(plants)), current(0) {}
     
 void GreenhouseIterator::first()  
 {
@@ -17,10 +19,10 @@ void GreenhouseIterator::next()
     
 bool GreenhouseIterator::isDone() const  
 {
-    return current >= plants.size();
+    return current >= plants->size();
 }
     
 Plant* GreenhouseIterator::currentItem() const  
 {
-    return isDone() ? nullptr : plants[current];
+    return isDone() ? nullptr : (*plants)[current];
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 #include "Iterator.h"
 #include "Plant.h"
+#include "PlantSnapshot.h"
 #include <vector>
 
 /**
@@ -31,6 +32,12 @@ public:
 
     explicit GreenhouseIterator(const std::vector<Plant*>& plants);
 
+    /**
+     * @brief Constructor sharing an existing snapshot instead of copying it.
+     * @param plants The snapshot to iterate over; may be shared with other iterators.
+     */
+    explicit GreenhouseIterator(PlantSnapshot plants);
+
     /**
      * @brief Resets the iterator to the beginning of the collection.
      */
@@ -60,10 +67,10 @@ public:
 private:
 
     /**
-     * @brief A copy of the collection (or a reference/pointer to it) being iterated over.
+     * @brief The snapshot being iterated over, shared with the Greenhouse and other iterators.
      */
 
-    std::vector<Plant*> plants;
+    PlantSnapshot plants;
 
     /**
      * @brief The current position (index) within the `plants` vector.
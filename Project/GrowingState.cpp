@@ -27,8 +27,9 @@
  * (threshold = 12.0 * growth rate * season factor)
  * (season factor = 0.8 in thriving season, 1.2 otherwise)
  * @param plant Reference to the Plant object whose state is being checked
+ * @param context Frozen time and season of the current tick
  */
-void GrowingState::checkChange(Plant& plant)
+void GrowingState::checkChange(Plant& plant, const TickContext& context)
 {
     plant.addWater(-2);
     plant.addInsecticide(-1);
@@ -44,9 +45,7 @@ void GrowingState::checkChange(Plant& plant)
         if (plant.getInsecticide() < 25) plant.addHealth(-3);
     }
 
-    auto* sp = plant.getSpeciesFly();
-    double growthRate = sp->getGrowthRate();
-    double adjustedThreshold = 12.0 * growthRate * ((plant.currentSeason() == sp->getThrivingSeason()) ? 0.8 : 1.2);
+    double adjustedThreshold = maturityThreshold(plant.getSpeciesFly(), context.getSeason());
 
     if (plant.getHealth() <= 0)
     {
@@ -58,12 +57,30 @@ void GrowingState::checkChange(Plant& plant)
         plant.setState(&WiltingState::getInstance());
     }
 
-    else if (plant.getAgeDays() > adjustedThreshold && plant.getHealth() > 50)
+    else if (context.ageDays(plant.getCreatedAt()) > adjustedThreshold && plant.getHealth() > 50)
     {
         plant.setState(&MatureState::getInstance());
     }
 }
 
+/**
+ * @brief Computes the age a growing plant must exceed to move on to MatureState
+ *
+ * Shared with the batch tick in Greenhouse so both paths use the same threshold.
+ */
+double GrowingState::maturityThreshold(PlantFlyweight* species, Season current)
+{
+    return maturityThreshold(species->getTraits(), current);
+}
+
+/**
+ * @brief Computes the maturity threshold from a species traits record
+ */
+double GrowingState::maturityThreshold(const SpeciesTraits& traits, Season current)
+{
+    return 12.0 * traits.growthRate * ((current == traits.thrivingSeason) ? 0.8 : 1.2);
+}
+
 /**
  * @brief Returns the name identifier for this state
  * @return The string "Growing"
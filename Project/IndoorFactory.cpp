@@ -1,14 +1,17 @@
 #include "IndoorFactory.h"
 IndoorStrategy IndoorFactory::s;
 
-Pot* IndoorFactory::createPot() 
+CeramicPot IndoorFactory::sharedPot;
+LightAirySoilMix IndoorFactory::sharedSoil;
+
+Pot* IndoorFactory::pot() 
 {
-	return new CeramicPot();
+	return &sharedPot;
 }
 
-SoilMix* IndoorFactory::createSoilMix() 
+SoilMix* IndoorFactory::soilMix() 
 {
-	return new LightAirySoilMix();
+	return &sharedSoil;
 }
 
 CareStrategy* IndoorFactory::careStrategy()
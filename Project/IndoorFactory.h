@@ -29,6 +29,12 @@ class IndoorFactory : public PlantKitFactory
     /// Static instance of the IndoorStrategy (can be used as singleton).
     static IndoorStrategy s;
 
+    /// Pot shared by every indoor plant (Flyweight).
+    static CeramicPot sharedPot;
+
+    /// Soil mix shared by every indoor plant (Flyweight).
+    static LightAirySoilMix sharedSoil;
+
 public:
 
     /**
@@ -40,16 +46,16 @@ public:
 protected:
 
     /**
-     * @brief Creates an indoor-appropriate pot.
-     * @return Pointer to a Pot instance (CeramicPot).
+     * @brief Returns the shared indoor-appropriate pot.
+     * @return Pointer to the shared Pot (CeramicPot).
      */
-    Pot* createPot() override;
+    Pot* pot() override;
 
     /**
-     * @brief Creates an indoor-appropriate soil mix.
-     * @return Pointer to a SoilMix instance (LightAirySoilMix).
+     * @brief Returns the shared indoor-appropriate soil mix.
+     * @return Pointer to the shared SoilMix (LightAirySoilMix).
      */
-    SoilMix* createSoilMix() override;
+    SoilMix* soilMix() override;
 };
 
 #endif
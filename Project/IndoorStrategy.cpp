@@ -30,7 +30,7 @@ void IndoorStrategy::water(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
     
-    int add = static_cast<int>(18 + (species->getWaterSensitivity() * 7));
+    int add = static_cast<int>(18 + (species->getTraits().waterSensitivity * 7));
     const int before = plant.getMoisture();
     const int projected = before + add;
     if (projected > 100)
@@ -55,7 +55,7 @@ void IndoorStrategy::fertilize(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
     
-    int healthBoost = 5 + static_cast<int>(species->getGrowthRate() * 4);
+    int healthBoost = 5 + static_cast<int>(species->getTraits().growthRate * 4);
     if (plant.getHealth() < 60) 
     {
         plant.addHealth(healthBoost);
@@ -77,7 +77,7 @@ void IndoorStrategy::sprayInsecticide(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;    
 
-    int add = 12 + static_cast<int>(species->getInsecticideTolerance() * 6);
+    int add = 12 + static_cast<int>(species->getTraits().insecticideTolerance * 6);
     const int before = plant.getInsecticide();
     const int projected = before + add;
     if (projected > 100) 
@@ -0,0 +1,122 @@
+/**
+ * @file Inventory.cpp
+ * @brief Implementation of the Inventory status rows and per-species status lists
+ */
+
+#include "Inventory.h"
+#include <algorithm>
+
+std::uint32_t Inventory::add(PlantId plantId, SpeciesIndex species, Status status)
+{
+    if (rowByHandle.size() <= plantId.value())
+    {
+        // Handles are handed out densely, so grow geometrically instead of one id at a time.
+        rowByHandle.resize(std::max<std::size_t>(plantId.value() + 1, rowByHandle.size() * 2), kNoRow);
+    }
+    addSpecies(species);
+
+    std::uint32_t row;
+    if (!freeRows.empty())
+    {
+        row = freeRows.back();
+        freeRows.pop_back();
+        ids[row] = plantId;
+        speciesCol[row] = species;
+        statusCol[row] = status;
+    }
+    else
+    {
+        row = static_cast<std::uint32_t>(ids.size());
+        ids.push_back(plantId);
+        speciesCol.push_back(species);
+        statusCol.push_back(status);
+        prevRow.push_back(kNoRow);
+        nextRow.push_back(kNoRow);
+    }
+    rowByHandle[plantId.value()] = row;
+    link(row);
+    if (status == Status::Available) noteAvailable(row, true);
+    return row;
+}
+
+void Inventory::setStatus(std::uint32_t row, Status status)
+{
+    if (statusCol[row] == status) return;
+    if (statusCol[row] == Status::Available) noteAvailable(row, false);
+    else if (status == Status::Available) noteAvailable(row, true);
+    unlink(row);
+    statusCol[row] = status;
+    link(row);
+}
+
+void Inventory::retire(std::uint32_t row, Status status)
+{
+    if (statusCol[row] == Status::Available) noteAvailable(row, false);
+    unlink(row);
+    retire(ids[row], speciesCol[row], status);
+    rowByHandle[ids[row].value()] = kNoRow;
+    ids[row] = PlantId();
+    speciesCol[row] = kNoSpecies;
+    freeRows.push_back(row);
+}
+
+void Inventory::retire(PlantId plantId, SpeciesIndex species, Status status)
+{
+    addSpecies(species);
+    if (species < retired.size()) ++retired[species][static_cast<std::size_t>(status)];
+    archive.append(plantId, status == Status::Sold ? "SOLD" : "DEAD");
+}
+
+void Inventory::addSpecies(SpeciesIndex species)
+{
+    if (species == kNoSpecies || species < lists.size()) return;
+    lists.resize(species + 1);
+    retired.resize(species + 1, std::array<int, kStatusCount>{});
+}
+
+bool Inventory::availableChangesSince(std::uint64_t generation, std::vector<AvailableChange>& out) const
+{
+    if (generation < journalBase || generation > availableGeneration()) return false;
+    out.insert(out.end(), journal.begin() + static_cast<std::ptrdiff_t>(generation - journalBase), journal.end());
+    return true;
+}
+
+/**
+ * @brief Drops the older half of the journal once it is full, so appending stays amortised O(1)
+ */
+void Inventory::noteAvailable(std::uint32_t row, bool added)
+{
+    if (journal.size() == 2 * kJournalLimit)
+    {
+        journal.erase(journal.begin(), journal.begin() + kJournalLimit);
+        journalBase += kJournalLimit;
+    }
+    journal.push_back(AvailableChange{ ids[row], added });
+}
+
+/**
+ * @brief Rows without a species are kept but belong to no list
+ */
+void Inventory::link(std::uint32_t row)
+{
+    if (speciesCol[row] >= lists.size()) return;
+    StatusList& list = lists[speciesCol[row]][static_cast<std::size_t>(statusCol[row])];
+    prevRow[row] = list.tail;
+    nextRow[row] = kNoRow;
+    if (list.tail != kNoRow) nextRow[list.tail] = row;
+    else list.head = row;
+    list.tail = row;
+    ++list.count;
+}
+
+void Inventory::unlink(std::uint32_t row)
+{
+    if (speciesCol[row] >= lists.size()) return;
+    StatusList& list = lists[speciesCol[row]][static_cast<std::size_t>(statusCol[row])];
+    if (prevRow[row] != kNoRow) nextRow[prevRow[row]] = nextRow[row];
+    else list.head = nextRow[row];
+    if (nextRow[row] != kNoRow) prevRow[nextRow[row]] = prevRow[row];
+    else list.tail = prevRow[row];
+    prevRow[row] = nextRow[row] = kNoRow;
+    --list.count;
+}
@@ -6,14 +6,25 @@
 
 #ifndef INVENTORY_H
 #define INVENTORY_H
-#include <string>
-#include <unordered_set>
-#include <unordered_map>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "PlantId.h"
+#include "InventoryArchive.h"
 
 /**
  * @struct Inventory
  * @brief A comprehensive structure containing records of all matured plants, tracking their status
  * through their sales lifecycle (Available, Reserved, Sold, etc.).
+ *
+ * Records are kept in dense rows: one status byte, species and id per plant, found through a flat
+ * table indexed by the PlantId handle. Every row is also linked into the list of its species and
+ * status, and each list keeps its length, so a status change is a constant-time relink and the
+ * per-species counts are array reads. No string is hashed and nothing is allocated per change.
+ *
+ * Only live plants keep a row. A plant that is sold or dies is retired: its row is recycled, the
+ * record goes to the append-only archive, and the species' Sold or Dead counter is bumped. Memory
+ * therefore follows the live stock, while count() still reports every sale ever made.
  */
 
 struct Inventory
@@ -23,7 +34,7 @@ struct Inventory
      * @brief Represents the current disposition or state of a plant for sales purposes.
      */
 
-enum class Status {
+enum class Status : std::uint8_t {
         /** @brief The plant is ready and available for sale. */
         Available,
         /** @brief The plant has been allocated to an order but not yet sold. */
@@ -36,39 +47,251 @@ enum class Status {
         Dead
     };
 
-    /**
-     * @struct PlantRec
-     * @brief A record structure holding the key details for a single plant in the inventory.
-     */
-	struct PlantRec
-    {
-        /** @brief The unique identifier for the individual plant. */
-        std::string plantId;
-        /** @brief The Stock Keeping Unit (SKU) for the plant's species. */
-        std::string speciesSku;
-        /** @brief The current sales status of the plant. Defaults to Available. */
-        Status status = Status::Available;
-    };
+	/** @brief Number of Status values. */
+	static constexpr std::size_t kStatusCount = 5;
+
+	/** @brief Row index meaning "no record". */
+	static constexpr std::uint32_t kNoRow = 0xFFFFFFFFu;
+
+	/**
+     * @brief A plant entering or leaving the Available status.
+     */
+	struct AvailableChange
+	{
+		/** @brief The plant. */
+		PlantId plantId;
+		/** @brief true if it became available, false if it stopped being available. */
+		bool added;
+	};
+
+	/**
+     * @brief Finds the record of a plant.
+     * @param plantId The plant's id.
+     * @return Its row, or kNoRow if the plant has no record.
+     */
+	std::uint32_t find(PlantId plantId) const
+	{
+		return plantId.value() < rowByHandle.size() ? rowByHandle[plantId.value()] : kNoRow;
+	}
+
+	/**
+     * @brief Adds a record. The plant must not have one yet.
+     * @param plantId The plant's id.
+     * @param species The plant's species.
+     * @param status Its initial status.
+     * @return The new row.
+     */
+	std::uint32_t add(PlantId plantId, SpeciesIndex species, Status status);
+
+	/**
+     * @brief Moves a record to another status list in constant time.
+     * @param row The record.
+     * @param status The new status; nothing happens if it is the current one.
+     */
+	void setStatus(std::uint32_t row, Status status);
+
+	/**
+     * @brief Archives a record and frees its row for reuse.
+     * @param row The record.
+     * @param status Sold or Dead; counted for the row's species.
+     */
+	void retire(std::uint32_t row, Status status);
+
+	/**
+     * @brief Archives a plant that never had a row.
+     * @param plantId The plant's id.
+     * @param species The plant's species.
+     * @param status Sold or Dead; counted for the species.
+     */
+	void retire(PlantId plantId, SpeciesIndex species, Status status);
+
+	/**
+     * @brief Starts writing retired records to a file.
+     * @param path Path of the archive file; records are appended to it.
+     * @return true if the file could be opened.
+     */
+	bool openArchive(const std::string& path) { return archive.open(path); }
+
+	/**
+     * @brief Returns the archive retired records are written to.
+     * @return The archive.
+     */
+	InventoryArchive& getArchive() { return archive; }
+
+	/** @brief Returns the status of a row. */
+	Status statusOf(std::uint32_t row) const { return statusCol[row]; }
+
+	/** @brief Returns the species of a row. */
+	SpeciesIndex speciesOf(std::uint32_t row) const { return speciesCol[row]; }
+
+	/** @brief Returns the plant id of a row. */
+	PlantId idOf(std::uint32_t row) const { return ids[row]; }
+
+	/**
+     * @brief Counts the records of a species in a status, retired ones included.
+     * @param species The species' index, or kNoSpecies.
+     * @param status The status.
+     * @return The number of plants, or 0 if the species has no records.
+     */
+	int count(SpeciesIndex species, Status status) const
+	{
+		if (species >= lists.size()) return 0;
+		const std::size_t s = static_cast<std::size_t>(status);
+		return lists[species][s].count + retired[species][s];
+	}
+
+	/**
+     * @brief Returns the oldest record of a species in a status; walk on with next().
+     * @param species The species' index, or kNoSpecies.
+     * @param status The status.
+     * @return The first row of the list, or kNoRow.
+     */
+	std::uint32_t first(SpeciesIndex species, Status status) const
+	{
+		return species < lists.size() ? lists[species][static_cast<std::size_t>(status)].head : kNoRow;
+	}
+
+	/**
+     * @brief Returns the next record in the list of a row.
+     * @param row A row.
+     * @return The next row in the same species and status, or kNoRow.
+     */
+	std::uint32_t next(std::uint32_t row) const { return nextRow[row]; }
+
+	/**
+     * @brief Returns the number of species that have records.
+     * @return One past the highest species index seen.
+     */
+	SpeciesIndex speciesCount() const { return static_cast<SpeciesIndex>(lists.size()); }
+
+	/**
+     * @brief Returns the generation of the set of available plants.
+     * @details Every plant entering or leaving the Available status moves it on by one, so two
+     * equal generations mean the set did not change in between.
+     * @return The current generation.
+     */
+	std::uint64_t availableGeneration() const { return journalBase + journal.size(); }
+
+	/**
+     * @brief Collects the changes to the available set since a generation.
+     * @details Only the most recent changes are kept. When a generation is older than that, the
+     * caller has to start over from a full listing.
+     * @param generation A generation returned earlier by availableGeneration().
+     * @param out Receives the changes, oldest first.
+     * @return false if the changes since that generation are no longer known.
+     */
+	bool availableChangesSince(std::uint64_t generation, std::vector<AvailableChange>& out) const;
+
+	/**
+     * @brief Returns the number of live records.
+     * @return The number of rows in use.
+     */
+	std::uint32_t size() const { return static_cast<std::uint32_t>(ids.size() - freeRows.size()); }
+
+private:
+
+	/**
+     * @brief A doubly linked list of rows, threaded through prevRow and nextRow.
+     */
+	struct StatusList
+	{
+		/** @brief Oldest row, or kNoRow. */
+		std::uint32_t head = kNoRow;
+		/** @brief Newest row, or kNoRow. */
+		std::uint32_t tail = kNoRow;
+		/** @brief Number of rows in the list. */
+		int count = 0;
+	};
+
+	/**
+     * @brief Grows the per-species tables to hold a species.
+     * @param species The species' index; kNoSpecies is ignored.
+     */
+	void addSpecies(SpeciesIndex species);
+
+	/**
+     * @brief Appends a row to the list of its species and status.
+     * @param row The row.
+     */
+	void link(std::uint32_t row);
+
+	/**
+     * @brief Removes a row from the list of its species and status.
+     * @param row The row.
+     */
+	void unlink(std::uint32_t row);
+
+	/**
+     * @brief Records a row entering or leaving the available set.
+     * @param row The row.
+     * @param added true if it became available.
+     */
+	void noteAvailable(std::uint32_t row, bool added);
+
+	/**
+     * @brief Number of recent changes the journal always keeps; older ones are dropped in halves.
+     */
+	static constexpr std::size_t kJournalLimit = 4096;
+
+	/**
+     * @brief Row of each plant, indexed by PlantId handle; kNoRow where the plant has no record.
+     */
+	std::vector<std::uint32_t> rowByHandle;
+
+	/**
+     * @brief Plant id of each row.
+     */
+	std::vector<PlantId> ids;
+
+	/**
+     * @brief Species of each row.
+     */
+	std::vector<SpeciesIndex> speciesCol;
+
+	/**
+     * @brief Status byte of each row.
+     */
+	std::vector<Status> statusCol;
+
+	/**
+     * @brief Previous row in the same list, or kNoRow.
+     */
+	std::vector<std::uint32_t> prevRow;
+
+	/**
+     * @brief Next row in the same list, or kNoRow.
+     */
+	std::vector<std::uint32_t> nextRow;
+
+	/**
+     * @brief One list per status for each species, indexed by SpeciesIndex then Status.
+     */
+	std::vector<std::array<StatusList, kStatusCount>> lists;
+
+	/**
+     * @brief Retired records per species and status, indexed like lists.
+     */
+	std::vector<std::array<int, kStatusCount>> retired;
 
 	/**
-     * @brief Main map storing all plant records, keyed by the unique plant ID.
+     * @brief Rows freed by retire(), reused by add().
      */
-	std::unordered_map<std::string, PlantRec> byId;
+	std::vector<std::uint32_t> freeRows;
 
 	/**
-     * @brief Index mapping species SKU to a set of plant IDs that are currently available for sale.
+     * @brief Where retired records are written.
      */
-	std::unordered_map<std::string, std::unordered_set<std::string>> availBySku;
+	InventoryArchive archive;
 
 	/**
-     * @brief Index mapping species SKU to a set of plant IDs that are currently reserved for pending orders.
+     * @brief Recent changes to the available set; entry i moved the generation from journalBase + i.
      */
-  	std::unordered_map<std::string, std::unordered_set<std::string>> reservedBySku;
+	std::vector<AvailableChange> journal;
 
 	/**
-     * @brief Index mapping species SKU to a set of plant IDs that have been sold.
+     * @brief Generation before the first change kept in the journal.
      */
-  	std::unordered_map<std::string, std::unordered_set<std::string>> soldBySku;
+	std::uint64_t journalBase = 0;
 };
 
 #endif
@@ -0,0 +1,41 @@
+/**
+ * @file InventoryArchive.cpp
+ * @brief Implementation of the append-only inventory archive
+ */
+
+#include "InventoryArchive.h"
+#include "SimClock.h"
+#include <charconv>
+#include <chrono>
+
+bool InventoryArchive::open(const std::string& path)
+{
+    if (file.is_open()) file.close();
+    file.open(path, std::ios::out | std::ios::app);
+    return file.is_open();
+}
+
+void InventoryArchive::append(PlantId plantId, const char* disposition)
+{
+    ++records;
+    if (!file.is_open()) return;
+
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(
+        SimClock::current().now().time_since_epoch()).count();
+    char digits[24];
+    std::to_chars_result r = std::to_chars(digits, digits + sizeof digits, seconds);
+
+    line.clear();
+    plantId.appendTo(line);
+    line += ' ';
+    line += disposition;
+    line += ' ';
+    line.append(digits, r.ptr);
+    line += '\n';
+    file.write(line.data(), static_cast<std::streamsize>(line.size()));
+}
+
+void InventoryArchive::flush()
+{
+    if (file.is_open()) file.flush();
+}
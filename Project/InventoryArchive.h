@@ -0,0 +1,75 @@
+/**
+ * @file InventoryArchive.h
+ * @brief Defines the InventoryArchive class, the append-only file that sold and dead inventory
+ * records are moved to.
+ */
+
+#ifndef INVENTORYARCHIVE_H
+#define INVENTORYARCHIVE_H
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "PlantId.h"
+
+/**
+ * @class InventoryArchive
+ * @brief Append-only log of retired inventory records, one line per plant.
+ *
+ * Each line holds the plant id, its disposition (SOLD or DEAD) and the simulated time in seconds
+ * since the epoch, separated by spaces. Lines are only ever appended, so the file can be read
+ * back or rotated while the nursery runs. Without an open file, records are only counted.
+ */
+class InventoryArchive
+{
+
+public:
+
+    InventoryArchive() = default;
+
+    InventoryArchive(const InventoryArchive&) = delete;
+    InventoryArchive& operator=(const InventoryArchive&) = delete;
+
+    /**
+     * @brief Opens (or creates) the archive file and appends to its end.
+     * @param path Path of the file.
+     * @return true if the file is open for writing.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Checks whether records are written to a file.
+     * @return true if open() succeeded.
+     */
+    bool isOpen() const { return file.is_open(); }
+
+    /**
+     * @brief Appends a record.
+     * @param plantId The retired plant.
+     * @param disposition Why it was retired, e.g. "SOLD" or "DEAD".
+     */
+    void append(PlantId plantId, const char* disposition);
+
+    /**
+     * @brief Writes buffered records to the file.
+     */
+    void flush();
+
+    /**
+     * @brief Returns the number of records appended since construction.
+     * @return The record count, whether or not a file is open.
+     */
+    std::uint64_t recordCount() const { return records; }
+
+private:
+
+    /// The archive file; closed when records are only counted.
+    std::ofstream file;
+
+    /// Reused buffer a record is formatted into.
+    std::string line;
+
+    /// Records appended so far.
+    std::uint64_t records = 0;
+};
+
+#endif
@@ -11,6 +11,7 @@
 #include <stdexcept>
 #include <optional>
 #include <iostream>
+#include <algorithm>
 
 /**
  * @brief Constructor for InventoryService
@@ -26,13 +27,10 @@ InventoryService::InventoryService(Inventory& store, Greenhouse& gh) : inv(store
  * @param speciesSku The species SKU of the plant
  * @returns true if the plant was added successfully, false otherwise
  */
-bool InventoryService::addPlant(std::string plantId, std::string speciesSku) 
+bool InventoryService::addPlant(PlantId plantId, std::string speciesSku) 
 {
-	if (inv.byId.count(plantId)) return false;
-  	Inventory::PlantRec rec{ plantId, speciesSku, Inventory::Status::Available };
-
-  	inv.byId.emplace(plantId, rec);
-  	inv.availBySku[speciesSku].insert(plantId);
+	if (inv.find(plantId) != Inventory::kNoRow) return false;
+  	inv.add(plantId, SkuTable::intern(speciesSku), Inventory::Status::Available);
   	return true;
 }
 
@@ -41,17 +39,12 @@ bool InventoryService::addPlant(std::string plantId, std::string speciesSku)
  * @param plantId The unique ID of the plant
  * @returns void
  */
-void InventoryService::releasePlantFromOrder(std::string plantId) 
+void InventoryService::releasePlantFromOrder(PlantId plantId) 
 {
-	auto it = inv.byId.find(plantId);
-  	if (it == inv.byId.end()) return;
-
-  	Inventory::PlantRec& rec = it->second;
-  	if (rec.status != Inventory::Status::Reserved) return;
+	const std::uint32_t row = inv.find(plantId);
+  	if (row == Inventory::kNoRow || inv.statusOf(row) != Inventory::Status::Reserved) return;
 
-  	inv.reservedBySku[rec.speciesSku].erase(plantId);
-  	rec.status = Inventory::Status::Available;
-  	inv.availBySku[rec.speciesSku].insert(plantId);
+  	inv.setStatus(row, Inventory::Status::Available);
 }
 
 /**
@@ -59,26 +52,12 @@ void InventoryService::releasePlantFromOrder(std::string plantId)
  * @param plantId The unique ID of the plant
  * @returns true if the plant was sold successfully, false otherwise
  */
-bool InventoryService::markSold(std::string plantId) 
+bool InventoryService::markSold(PlantId plantId) 
 {
-  	auto it = inv.byId.find(plantId);
-  	if (it == inv.byId.end()) return false;
-
-  	Inventory::PlantRec& rec = it->second;
-  	if (rec.status == Inventory::Status::Sold) return false;
-
-  	if (rec.status == Inventory::Status::Available) 
-  	{
-    	inv.availBySku[rec.speciesSku].erase(plantId);
-  	} 
-  	else if (rec.status == Inventory::Status::Reserved)
-  	{
-    	inv.reservedBySku[rec.speciesSku].erase(plantId);
-  	}
-  	
-  	rec.status = Inventory::Status::Sold;
-  	inv.soldBySku[rec.speciesSku].insert(plantId);
-  	
+  	const std::uint32_t row = inv.find(plantId);
+  	if (row == Inventory::kNoRow) return false;
+
+  	inv.retire(row, Inventory::Status::Sold);
   	return true;
 }
 
@@ -87,36 +66,59 @@ bool InventoryService::markSold(std::string plantId)
  * @param speciesSku The species SKU to check
  * @returns The count of available plants for the specified species
  */
-int InventoryService::availableCount(std::string speciesSku)  
+int InventoryService::availableCount(const std::string& speciesSku)  
 {
-	auto it = inv.availBySku.find(speciesSku);
-	return (it == inv.availBySku.end()) ? 0 : static_cast<int>(it->second.size());
+	return inv.count(SkuTable::find(speciesSku), Inventory::Status::Available);
 }
 
 /**
  * @brief Lists all available plants in the inventory
  * @returns A vector of plant IDs that are available for purchase
  */
-std::vector<std::string> InventoryService::listAvailablePlants()
+std::vector<PlantId> InventoryService::listAvailablePlants()
 {
-	std::vector<std::string> out;
-	out.reserve(inv.availBySku.size());
-	for (const auto& kv : inv.availBySku)
+	std::vector<PlantId> out;
+	std::size_t total = 0;
+	for (SpeciesIndex s = 0; s < inv.speciesCount(); ++s) total += inv.count(s, Inventory::Status::Available);
+	out.reserve(total);
+	for (SpeciesIndex s = 0; s < inv.speciesCount(); ++s)
 	{
-		for (const auto& id : kv.second) out.push_back(id);
+		for (std::uint32_t row = inv.first(s, Inventory::Status::Available); row != Inventory::kNoRow; row = inv.next(row))
+		{
+			out.push_back(inv.idOf(row));
+		}
 	}
 	return out;
 }
 
+/**
+ * @brief Returns the generation of the set of available plants
+ * @returns The current generation
+ */
+std::uint64_t InventoryService::availableGeneration() const
+{
+	return inv.availableGeneration();
+}
+
+/**
+ * @brief Collects the plants that became or stopped being available since a generation
+ * @param generation A generation returned earlier by availableGeneration()
+ * @param out Receives the changes, oldest first
+ * @returns false if that generation is too old
+ */
+bool InventoryService::availableChangesSince(std::uint64_t generation, std::vector<Inventory::AvailableChange>& out) const
+{
+	return inv.availableChangesSince(generation, out);
+}
+
 /**
  * @brief Finds the amount of available plants of a certain species that are reserved
  * @param speciesSku The species SKU to check
  * @returns The count of reserved plants for the specified species
  */
-int InventoryService::reservedCount(std::string speciesSku)  
+int InventoryService::reservedCount(const std::string& speciesSku)  
 {
-	auto it = inv.reservedBySku.find(speciesSku);
-	return (it == inv.reservedBySku.end()) ? 0 : static_cast<int>(it->second.size());
+	return inv.count(SkuTable::find(speciesSku), Inventory::Status::Reserved);
 }
 
 /**
@@ -124,10 +126,9 @@ int InventoryService::reservedCount(std::string speciesSku)
  * @param speciesSku The species SKU to check
  * @returns The count of sold plants for the specified species
  */
-int InventoryService::soldCount(std::string speciesSku)  
+int InventoryService::soldCount(const std::string& speciesSku)  
 {
-	auto it = inv.soldBySku.find(speciesSku);
-	return (it == inv.soldBySku.end()) ? 0 : static_cast<int>(it->second.size());
+	return inv.count(SkuTable::find(speciesSku), Inventory::Status::Sold);
 }
 
 /**
@@ -135,22 +136,101 @@ int InventoryService::soldCount(std::string speciesSku)
  * @param plantId The unique ID of the plant
  * @returns true if the plant was reserved successfully, false otherwise
  */
-bool InventoryService::reservePlant(std::string plantId)
+bool InventoryService::reservePlant(PlantId plantId)
 {
-    auto it = inv.byId.find(plantId);
-    if (it == inv.byId.end()) return false;
+    const std::uint32_t row = inv.find(plantId);
+    if (row == Inventory::kNoRow || inv.statusOf(row) != Inventory::Status::Available) return false;
 
-    Inventory::PlantRec& rec = it->second;
-    if (rec.status != Inventory::Status::Available) return false;
+    inv.setStatus(row, Inventory::Status::Reserved);
+    return true;
+}
 
-    rec.status = Inventory::Status::Reserved;
+/**
+ * @brief Reserves many plants at once
+ * @param plantIds The plants to reserve, e.g. the lines of a cart
+ * @param allOrNothing true to reserve no plant unless all of them can be reserved
+ * @returns One result per id, in the order given
+ */
+std::vector<ReserveResult> InventoryService::reserveBatch(const std::vector<PlantId>& plantIds, bool allOrNothing)
+{
+    std::vector<ReserveResult> results(plantIds.size(), ReserveResult::Reserved);
+    std::vector<std::uint32_t> order(plantIds.size());
+    for (std::uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+    // Stable, so the first of several equal ids is the one that counts.
+    std::stable_sort(order.begin(), order.end(), [&plantIds](std::uint32_t a, std::uint32_t b) { return plantIds[a] < plantIds[b]; });
 
-    auto skuIt = inv.availBySku.find(rec.speciesSku);
+    std::vector<std::uint32_t> rows(plantIds.size(), Inventory::kNoRow);
+    bool allReserved = true;
+    for (std::size_t k = 0; k < order.size(); ++k)
+    {
+        const std::uint32_t i = order[k];
+        const std::uint32_t row = inv.find(plantIds[i]);
+        if (k > 0 && plantIds[order[k - 1]] == plantIds[i]) results[i] = ReserveResult::Duplicate;
+        else if (row == Inventory::kNoRow) results[i] = ReserveResult::NotFound;
+        else if (inv.statusOf(row) != Inventory::Status::Available) results[i] = ReserveResult::Unavailable;
+        else rows[i] = row;
+        allReserved = allReserved && results[i] == ReserveResult::Reserved;
+    }
 
-    if (skuIt != inv.availBySku.end()) skuIt->second.erase(plantId);
+    for (std::uint32_t i : order)
+    {
+        if (results[i] != ReserveResult::Reserved) continue;
+        if (allOrNothing && !allReserved) results[i] = ReserveResult::Skipped;
+        else inv.setStatus(rows[i], Inventory::Status::Reserved);
+    }
+    return results;
+}
 
-    inv.reservedBySku[rec.speciesSku].insert(plantId);
-    return true;
+/**
+ * @brief Reserves any N available plants of a species
+ * @param speciesSku The species SKU
+ * @param quantity How many plants to reserve
+ * @param order Which plants to prefer
+ * @returns The reserved plant IDs; empty, with nothing reserved, if fewer than quantity are available
+ */
+std::vector<PlantId> InventoryService::reserveAnyOfSku(const std::string& speciesSku, int quantity, PickOrder order)
+{
+    std::vector<PlantId> picked;
+    const SpeciesIndex species = SkuTable::find(speciesSku);
+    if (quantity <= 0 || inv.count(species, Inventory::Status::Available) < quantity) return picked;
+    picked.reserve(quantity);
+
+    if (order == PickOrder::Oldest)
+    {
+        // The list is in the order plants became available; its head is the oldest stock.
+        std::uint32_t row = inv.first(species, Inventory::Status::Available);
+        while (static_cast<int>(picked.size()) < quantity)
+        {
+            const std::uint32_t next = inv.next(row);
+            picked.push_back(inv.idOf(row));
+            inv.setStatus(row, Inventory::Status::Reserved);
+            row = next;
+        }
+        return picked;
+    }
+
+    // (health, position in the list); plants missing from the greenhouse come last.
+    std::vector<std::pair<int, std::uint32_t>> candidates;
+    std::vector<std::uint32_t> rows;
+    candidates.reserve(inv.count(species, Inventory::Status::Available));
+    rows.reserve(candidates.capacity());
+    for (std::uint32_t row = inv.first(species, Inventory::Status::Available); row != Inventory::kNoRow; row = inv.next(row))
+    {
+        Plant* p = gh.getPlant(inv.idOf(row));
+        candidates.emplace_back(p ? p->getHealth() : -1, static_cast<std::uint32_t>(rows.size()));
+        rows.push_back(row);
+    }
+    // Healthiest first; among equals, the oldest stock.
+    std::partial_sort(candidates.begin(), candidates.begin() + quantity, candidates.end(),
+                      [](const std::pair<int, std::uint32_t>& a, const std::pair<int, std::uint32_t>& b)
+                      { return a.first != b.first ? a.first > b.first : a.second < b.second; });
+    for (int i = 0; i < quantity; ++i)
+    {
+        const std::uint32_t row = rows[candidates[i].second];
+        picked.push_back(inv.idOf(row));
+        inv.setStatus(row, Inventory::Status::Reserved);
+    }
+    return picked;
 }
 
 /**
@@ -162,53 +242,36 @@ bool InventoryService::reservePlant(std::string plantId)
  */
 void InventoryService::onEvent(events::Plant e)
 {
+    const SpeciesIndex species = e.species != kNoSpecies ? e.species : SkuTable::intern(e.sku);
     switch (e.type)
     {
         case events::PlantType::Matured:
         {
-            auto it = inv.byId.find(e.plantId);
-            if (it == inv.byId.end())
-            {
-
-                Inventory::PlantRec rec{ e.plantId, e.sku, Inventory::Status::Available };
-                inv.byId.emplace(e.plantId, rec);
-                inv.availBySku[e.sku].insert(e.plantId);
-            }
-            else
-            {
-                bool wasWilted = (it->second.status == Inventory::Status::Wilted);
-                it->second.status = Inventory::Status::Available;
-                inv.availBySku[e.sku].insert(e.plantId);
-                inv.reservedBySku[e.sku].erase(e.plantId);
-                inv.soldBySku[e.sku].erase(e.plantId);
-            }
+            const std::uint32_t row = inv.find(e.plantId);
+            if (row == Inventory::kNoRow) inv.add(e.plantId, species, Inventory::Status::Available);
+            else inv.setStatus(row, Inventory::Status::Available);
             
             break;
         }
 
         case events::PlantType::Wilted:
         {
-            auto it = inv.byId.find(e.plantId);
-            if (it != inv.byId.end())
+            const std::uint32_t row = inv.find(e.plantId);
+            if (row != Inventory::kNoRow && inv.statusOf(row) == Inventory::Status::Available)
             {
-                if (it->second.status == Inventory::Status::Available)
-                {
-                    inv.availBySku[e.sku].erase(e.plantId);
-                    it->second.status = Inventory::Status::Wilted;
-                }
+                inv.setStatus(row, Inventory::Status::Wilted);
             }
             break;
         }
 
         case events::PlantType::Died:
         {
-            inv.byId[e.plantId].status = Inventory::Status::Dead;
-            inv.availBySku[e.sku].erase(e.plantId);
-            inv.reservedBySku[e.sku].erase(e.plantId);
-            inv.soldBySku[e.sku].erase(e.plantId);
+            const std::uint32_t row = inv.find(e.plantId);
+            if (row == Inventory::kNoRow) inv.retire(e.plantId, species, Inventory::Status::Dead);
+            else inv.retire(row, Inventory::Status::Dead);
             break;
         }
         default:
             break;
     }
-}
\ No newline at end of file
+}
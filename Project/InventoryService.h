@@ -18,6 +18,36 @@
 #include "Greenhouse.h"
 #include "Events.h"
 
+/**
+ * @enum ReserveResult
+ * @brief Outcome of one line of InventoryService::reserveBatch()
+ */
+enum class ReserveResult : std::uint8_t
+{
+	/** @brief The plant was available and is now reserved. */
+	Reserved,
+	/** @brief The inventory has no live record of the plant. */
+	NotFound,
+	/** @brief The plant exists but is reserved, wilted or otherwise not for sale. */
+	Unavailable,
+	/** @brief An earlier line of the batch names the same plant. */
+	Duplicate,
+	/** @brief The plant was available but left alone because another line failed an all-or-nothing batch. */
+	Skipped
+};
+
+/**
+ * @enum PickOrder
+ * @brief Which plants InventoryService::reserveAnyOfSku() takes first
+ */
+enum class PickOrder : std::uint8_t
+{
+	/** @brief The plants that have been for sale the longest (first in, first out). */
+	Oldest,
+	/** @brief The plants with the highest health in the greenhouse. */
+	Healthiest
+};
+
 /**
  * @class InventoryService
  * @brief Concrete Observer implementation for inventory management
@@ -61,55 +91,94 @@ public:
 	 * @param speciesSku The species SKU of the plant
 	 * @returns true if the plant was added successfully, false otherwise
 	 */
-	bool addPlant(std::string plantId, std::string speciesSku);
+	bool addPlant(PlantId plantId, std::string speciesSku);
 
 	/**
 	 * @brief Reserves a plant in the inventory
 	 * @param plantId The unique ID of the plant
 	 * @returns true if the plant was reserved successfully, false otherwise
 	 */
-	bool reservePlant(std::string plantId);
+	bool reservePlant(PlantId plantId);
+
+	/**
+	 * @brief Reserves many plants at once
+	 * @details The ids are validated in one pass over a sorted copy, which also finds repeated
+	 * ids, and only then are the available plants reserved. With allOrNothing, nothing is reserved
+	 * unless every line can be, so there is never anything to roll back.
+	 * @param plantIds The plants to reserve, e.g. the lines of a cart
+	 * @param allOrNothing true to reserve no plant unless all of them can be reserved
+	 * @returns One result per id, in the order given
+	 */
+	std::vector<ReserveResult> reserveBatch(const std::vector<PlantId>& plantIds, bool allOrNothing = false);
+
+	/**
+	 * @brief Reserves any N available plants of a species
+	 * @details The plants are taken straight from the species' available list, so the cost
+	 * depends on that species' stock only, never on the whole inventory.
+	 * @param speciesSku The species SKU
+	 * @param quantity How many plants to reserve
+	 * @param order Which plants to prefer
+	 * @returns The reserved plant IDs; empty, with nothing reserved, if fewer than quantity are available
+	 */
+	std::vector<PlantId> reserveAnyOfSku(const std::string& speciesSku, int quantity, PickOrder order = PickOrder::Oldest);
 
 	/**
 	 * @brief Effectively Sells a plant from the inventory
+	 * @details The record leaves the live tables for the archive; soldCount() still counts it.
 	 * @param plantId The unique ID of the plant
 	 * @returns true if the plant was sold successfully, false otherwise
 	 */
-	bool markSold(std::string plantId);
+	bool markSold(PlantId plantId);
 
 	/**
 	 * @brief Releases a plant from an order back to available inventory
 	 * @param plantId The unique ID of the plant
 	 * @returns void
 	 */
-	void releasePlantFromOrder(std::string plantId);
+	void releasePlantFromOrder(PlantId plantId);
 
 	/**
 	 * @brief Finds the amount of available for purchase plants of a certain species
 	 * @param speciesSku The species SKU to check
 	 * @returns The count of available plants for the specified species
 	 */
-	int availableCount(std::string speciesSku);
+	int availableCount(const std::string& speciesSku);
 
 	/**
 	 * @brief Finds the amount of available plants of a certain species that are reserved
 	 * @param speciesSku The species SKU to check
 	 * @returns The count of reserved plants for the specified species
 	 */
-	int reservedCount(std::string speciesSku);
+	int reservedCount(const std::string& speciesSku);
 
 	/**
 	 * @brief Finds the amount of sold plants of a certain species
 	 * @param speciesSku The species SKU to check
 	 * @returns The count of sold plants for the specified species
 	 */
-	int soldCount(std::string speciesSku);
+	int soldCount(const std::string& speciesSku);
 
 	/**
 	 * @brief Lists all available plants in the inventory
 	 * @returns A vector of plant IDs that are available for purchase
 	 */
-	std::vector<std::string> listAvailablePlants();
+	std::vector<PlantId> listAvailablePlants();
+
+	/**
+	 * @brief Returns the generation of the set of available plants
+	 * @details Equal generations mean no plant became or stopped being available in between,
+	 * so a caller holding a listing from that generation can keep it.
+	 * @returns The current generation
+	 */
+	std::uint64_t availableGeneration() const;
+
+	/**
+	 * @brief Collects the plants that became or stopped being available since a generation
+	 * @param generation A generation returned earlier by availableGeneration()
+	 * @param out Receives the changes, oldest first
+	 * @returns false if that generation is too old, in which case listAvailablePlants() has to be used
+	 */
+	bool availableChangesSince(std::uint64_t generation, std::vector<Inventory::AvailableChange>& out) const;
 
     /**
 	 * @brief Reaction to a Plant Event
@@ -24,7 +24,7 @@
  * - To WiltingState: if health <= 50
  * @param plant Reference to the Plant object whose state is being checked
  */
-void MatureState::checkChange(Plant& plant)
+void MatureState::checkChange(Plant& plant, const TickContext&)
 {
     plant.addWater(-5);
     plant.addInsecticide(-5);
@@ -21,11 +21,14 @@ public:
     /**
      * @brief Evaluates plant conditions and manages state transitions
      * @param plant Reference to the Plant object being evaluated
+     * @param context Frozen time and season of the current tick
      *
      * Decrements water and insecticide levels, adjusts health based on care conditions,
      * and transitions to DeadState or WiltingState.
      */
-    void checkChange(Plant& plant) override;
+    void checkChange(Plant& plant, const TickContext& context) override;
+
+    using PlantState::checkChange;
 
     /**
      * @brief Gets the name of this state
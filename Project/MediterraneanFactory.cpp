@@ -1,14 +1,17 @@
 #include "MediterraneanFactory.h"
 MediterraneanStrategy MediterraneanFactory::s;
 
-Pot* MediterraneanFactory::createPot() 
+UnglazedClayPot MediterraneanFactory::sharedPot;
+GrittyLimeSoilMix MediterraneanFactory::sharedSoil;
+
+Pot* MediterraneanFactory::pot() 
 {
-	return new UnglazedClayPot();
+	return &sharedPot;
 }
 
-SoilMix* MediterraneanFactory::createSoilMix() 
+SoilMix* MediterraneanFactory::soilMix() 
 {
-	return new GrittyLimeSoilMix();
+	return &sharedSoil;
 }
 
 CareStrategy* MediterraneanFactory::careStrategy()
@@ -29,6 +29,12 @@ class MediterraneanFactory : public PlantKitFactory
     /// Static instance of the MediterraneanStrategy (can be used as singleton).
     static MediterraneanStrategy s;
 
+    /// Pot shared by every Mediterranean plant (Flyweight).
+    static UnglazedClayPot sharedPot;
+
+    /// Soil mix shared by every Mediterranean plant (Flyweight).
+    static GrittyLimeSoilMix sharedSoil;
+
 public:
 
     /**
@@ -40,16 +46,16 @@ public:
 protected:
 
     /**
-     * @brief Creates a Mediterranean-appropriate pot.
-     * @return Pointer to a Pot instance (UnglazedClayPot).
+     * @brief Returns the shared Mediterranean-appropriate pot.
+     * @return Pointer to the shared Pot (UnglazedClayPot).
      */
-    Pot* createPot() override;
+    Pot* pot() override;
 
     /**
-     * @brief Creates a Mediterranean-appropriate soil mix.
-     * @return Pointer to a SoilMix instance (GrittyLimeSoilMix).
+     * @brief Returns the shared Mediterranean-appropriate soil mix.
+     * @return Pointer to the shared SoilMix (GrittyLimeSoilMix).
      */
-    SoilMix* createSoilMix() override;
+    SoilMix* soilMix() override;
 };
 
 #endif
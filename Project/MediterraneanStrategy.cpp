@@ -29,7 +29,7 @@ void MediterraneanStrategy::water(Plant& plant)
 {
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
-    int add = static_cast<int>(15 + (species->getWaterSensitivity() * 8));
+    int add = static_cast<int>(15 + (species->getTraits().waterSensitivity * 8));
     const int before = plant.getMoisture();
     const int projected = before + add;
 
@@ -56,7 +56,7 @@ void MediterraneanStrategy::fertilize(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
     
-    int healthBoost = 6 + static_cast<int>(species->getGrowthRate() * 4);
+    int healthBoost = 6 + static_cast<int>(species->getTraits().growthRate * 4);
     if (plant.getHealth() < 60) 
     {
         plant.addHealth(healthBoost);
@@ -78,7 +78,7 @@ void MediterraneanStrategy::sprayInsecticide(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
     
-    int add = 16 + static_cast<int>(species->getInsecticideTolerance() * 8);
+    int add = 16 + static_cast<int>(species->getTraits().insecticideTolerance * 8);
     const int before = plant.getInsecticide();
     const int projected = before + add;
     if (projected > 100) 
@@ -11,13 +11,13 @@
 #include "Spray.h"
 #include "Restock.h"
 #include "MacroCommand.h"
-#include "SpeciesFlyweight.h"
 #include "PlantFlyweight.h"
 #include "Plant.h"
 #include "Events.h"
 #include "random"
-#include "Iterator.h"
 #include "WiltingState.h"
+#include <unordered_set>
+#include <algorithm>
  
 // Constructor
 NurseryFacade::NurseryFacade(InventoryService* inv, SalesService* sales, StaffService* staff, 
@@ -27,22 +27,78 @@ NurseryFacade::NurseryFacade(InventoryService* inv, SalesService* sales, StaffSe
 
 std::vector<Plant*> NurseryFacade::browseAvailable()
 {
-    std::vector<Plant*> out;
-    if (!inv || !greenhouse) return out;
+    if (!inv || !greenhouse) return {};
+    return *availableSnapshot();
+}
 
-    std::vector<std::string> ids = inv->listAvailablePlants();
-    out.reserve(ids.size());
+PlantSnapshot NurseryFacade::availableSnapshot()
+{
+    if (!inv || !greenhouse) return std::make_shared<const std::vector<Plant*>>();
+    refreshAvailable();
+    return availableView;
+}
+
+std::uint64_t NurseryFacade::availableGeneration()
+{
+    if (!inv || !greenhouse) return 0;
+    refreshAvailable();
+    return availableViewGen;
+}
 
-    for (const auto& id : ids)
+void NurseryFacade::refreshAvailable()
+{
+    const std::uint64_t inventoryGen = inv->availableGeneration();
+    const std::uint64_t membershipGen = greenhouse->membershipGeneration();
+    if (availableView && inventoryGen == availableInventoryGen && membershipGen == availableMembershipGen) return;
+
+    auto place = [this](std::vector<Plant*>& view, Plant* p)
+    {
+        const std::uint32_t handle = p->getPlantId().value();
+        if (availablePos.size() <= handle) availablePos.resize(std::max<std::size_t>(handle + 1, availablePos.size() * 2));
+        availablePos[handle] = static_cast<std::uint32_t>(view.size());
+        view.push_back(p);
+    };
+
+    // Plants joining or leaving the greenhouse are not in the inventory's journal, so those rebuild.
+    std::vector<Inventory::AvailableChange> changes;
+    if (availableView && membershipGen == availableMembershipGen && inv->availableChangesSince(availableInventoryGen, changes))
+    {
+        // Copy on write: callers still holding the old snapshot keep it unchanged.
+        if (availableView.use_count() > 1) availableView = std::make_shared<std::vector<Plant*>>(*availableView);
+        std::vector<Plant*>& view = *availableView;
+        for (const auto& change : changes)
+        {
+            if (change.added)
+            {
+                if (Plant* p = greenhouse->getPlant(change.plantId)) place(view, p);
+                continue;
+            }
+            const std::uint32_t handle = change.plantId.value();
+            const std::uint32_t pos = handle < availablePos.size() ? availablePos[handle] : 0;
+            if (pos >= view.size() || view[pos]->getPlantId() != change.plantId) continue;
+            view[pos] = view.back();
+            availablePos[view[pos]->getPlantId().value()] = pos;
+            view.pop_back();
+        }
+    }
+    else
     {
-        Plant* p = greenhouse->getPlant(id);
-        if (p) out.push_back(p);
+        auto view = std::make_shared<std::vector<Plant*>>();
+        std::vector<PlantId> ids = inv->listAvailablePlants();
+        view->reserve(ids.size());
+        for (const auto& id : ids)
+        {
+            if (Plant* p = greenhouse->getPlant(id)) place(*view, p);
+        }
+        availableView = std::move(view);
     }
 
-    return out;
+    availableInventoryGen = inventoryGen;
+    availableMembershipGen = membershipGen;
+    ++availableViewGen;
 }
 
-Receipt NurseryFacade::checkout(std::string customerId, std::vector<events::OrderLine>& lines, double amountPaid)
+Receipt NurseryFacade::checkout(std::string customerId, std::vector<events::OrderLine>& lines, double amountPaid, bool allOrNothing)
 {
     Receipt receipt;
     receipt.success = false;
@@ -81,20 +137,102 @@ Receipt NurseryFacade::checkout(std::string customerId, std::vector<events::Orde
         return receipt;
     }
     
-    std::vector<events::OrderLine> finalized;
+    std::vector<PlantId> ids;
+    ids.reserve(lines.size());
     for (const auto& line : lines) 
     {
-        bool ok = inv->reservePlant(line.plantId);
-        if (ok) finalized.push_back(line);
+        ids.push_back(line.plantId);
+    }
+    std::vector<ReserveResult> reserved = inv->reserveBatch(ids, allOrNothing);
+
+    std::vector<events::OrderLine> finalized;
+    finalized.reserve(lines.size());
+    std::string unavailable;
+    for (std::size_t i = 0; i < lines.size(); ++i) 
+    {
+        if (reserved[i] == ReserveResult::Reserved) finalized.push_back(lines[i]);
+        else if (reserved[i] != ReserveResult::Skipped) unavailable += " " + lines[i].plantId.str();
     }
     
     if (finalized.empty()) 
     {
-        receipt.message = "No items available";
+        receipt.message = allOrNothing && !unavailable.empty() ? "Items no longer available:" + unavailable : "No items available";
+        return receipt;
+    }
+    
+    return placeOrder(customerId, finalized, amountPaid);
+}
+
+Receipt NurseryFacade::checkoutBySku(std::string customerId, const std::string& sku, int quantity, double amountPaid, bool healthiestFirst)
+{
+    Receipt receipt;
+    receipt.success = false;
+    receipt.message = "Service unavailable";
+    
+    if (!sales || !inv || !staff || !customerService || !greenhouse) 
+    {
         return receipt;
     }
     
-    receipt = sales->checkout(customerId, finalized, amountPaid);
+    if (!customerService->getCustomer(customerId)) 
+    {
+        receipt.message = "Invalid customer";
+        return receipt;
+    }
+    
+    if (quantity <= 0)
+    {
+        receipt.message = "Cart is empty";
+        return receipt;
+    }
+    
+    std::vector<PlantId> ids = inv->reserveAnyOfSku(sku, quantity, healthiestFirst ? PickOrder::Healthiest : PickOrder::Oldest);
+    if (ids.empty()) 
+    {
+        receipt.message = "Only " + std::to_string(inv->availableCount(sku)) + " of " + sku + " in stock";
+        return receipt;
+    }
+    
+    // One price for every line, so a customer paying getSkuPrice() * quantity pays exactly the total.
+    const double unitPrice = getSkuPrice(sku);
+    std::vector<events::OrderLine> lines;
+    lines.reserve(ids.size());
+    double total = 0.0;
+    for (const PlantId& id : ids) 
+    {
+        Plant* p = greenhouse->getPlant(id);
+        lines.push_back(events::OrderLine{ id, sku, p ? p->name() : sku, unitPrice });
+        total += unitPrice;
+    }
+    
+    if (amountPaid < total) 
+    {
+        for (const PlantId& id : ids) 
+        {
+            inv->releasePlantFromOrder(id);
+        }
+        receipt.totalCost = total;
+        receipt.amountPaid = amountPaid;
+        receipt.message = "Insufficient payment. Required: R" + std::to_string(total);
+        return receipt;
+    }
+    
+    return placeOrder(customerId, lines, amountPaid);
+}
+
+double NurseryFacade::getSkuPrice(const std::string& sku)
+{
+    if (!greenhouse) return 0.0;
+    for (Plant* p : greenhouse->plantsOfSku(sku)) 
+    {
+        if (p) return p->cost();
+    }
+    return 0.0;
+}
+
+Receipt NurseryFacade::placeOrder(const std::string& customerId, std::vector<events::OrderLine>& lines, double amountPaid)
+{
+    Receipt receipt = sales->checkout(customerId, lines, amountPaid);
     
     if (receipt.success) 
     {
@@ -109,7 +247,7 @@ Receipt NurseryFacade::checkout(std::string customerId, std::vector<events::Orde
     
     else 
     {
-        for (const auto& line : finalized) 
+        for (const auto& line : lines) 
         {
             inv->releasePlantFromOrder(line.plantId);
         }
@@ -128,7 +266,9 @@ std::vector<Receipt> NurseryFacade::getCustomerReceipts(std::string customerId)
 Plant* NurseryFacade::getPlant(std::string id) 
 {
     if (!greenhouse) return nullptr;
-    return greenhouse->getPlant(id);
+    // Ids typed or pasted in the GUI may not exist; looking them up must not intern them.
+    const PlantId plantId = PlantId::find(id);
+    return plantId.valid() ? greenhouse->getPlant(plantId) : nullptr;
 }
 
 std::vector<events::Order> NurseryFacade::getCustomerOrders(std::string customerId) 
@@ -168,19 +308,20 @@ int NurseryFacade::getSpeciesQuantity(std::string sku)
     return greenhouse->countBySku(sku);
 }
 
+int NurseryFacade::getStateCount(const PlantState* state)
+{
+    if (!greenhouse) return 0;
+    return greenhouse->countByState(state);
+}
+
 std::vector<Plant*> NurseryFacade::listAllPlants()
 {
     std::vector<Plant*> result;
     if (!greenhouse) return result;
-    Iterator* it = greenhouse->createIterator();
-    if (it) 
+    result.reserve(greenhouse->getPlantCount());
+    for (Plant* p : greenhouse->plants()) 
     {
-        for (it->first(); !it->isDone(); it->next()) 
-        {
-            Plant* p = it->currentItem();
-            if (p) result.push_back(p);
-        }
-        delete it;
+        result.push_back(p);
     }
     return result;
 }
@@ -279,16 +420,11 @@ void NurseryFacade::runUrgentCare()
 {
     if (!greenhouse || !invoker) return;
 
-    Iterator* it = greenhouse->createStateIterator(&WiltingState::getInstance());
-    if (!it) return;
-
     std::vector<Plant*> wiltingPlants;
-    for (it->first(); !it->isDone(); it->next()) 
+    for (Plant* p : greenhouse->plantsInState(&WiltingState::getInstance())) 
     {
-        Plant* p = it->currentItem();
-        if (p) wiltingPlants.push_back(p);
+        wiltingPlants.push_back(p);
     }
-    delete it;
 
     if (wiltingPlants.empty()) 
     {
@@ -400,8 +536,8 @@ std::vector<Plant*> NurseryFacade::getPersonalizedRecommendations(const std::str
         
         for (auto* p : allPlants) 
         {
-            auto* fly = dynamic_cast<SpeciesFlyweight*>(p->getSpeciesFly());
-            if (fly && fly->getThrivingSeason() == currentSeason) 
+            const PlantFlyweight* fly = p->getSpeciesFly();
+            if (fly && fly->getTraits().careProfile && fly->getTraits().thrivingSeason == currentSeason) 
             {
                 seasonalPlants.push_back(p);
             } 
@@ -428,7 +564,7 @@ std::vector<Plant*> NurseryFacade::getPersonalizedRecommendations(const std::str
         return result;
     }
     
-    std::unordered_set<std::string> purchasedPlantIds;
+    std::unordered_set<PlantId> purchasedPlantIds;
     for (const auto& order : orders) 
     {
         for (const auto& line : order.lines) 
@@ -447,8 +583,8 @@ std::vector<Plant*> NurseryFacade::getPersonalizedRecommendations(const std::str
         
         for (auto* p : allPlants) 
         {
-            auto* fly = dynamic_cast<SpeciesFlyweight*>(p->getSpeciesFly());
-            if (fly && fly->getThrivingSeason() == currentSeason) 
+            const PlantFlyweight* fly = p->getSpeciesFly();
+            if (fly && fly->getTraits().careProfile && fly->getTraits().thrivingSeason == currentSeason) 
             {
                 seasonalPlants.push_back(p);
             } 
@@ -484,8 +620,7 @@ std::vector<Plant*> NurseryFacade::getPersonalizedRecommendations(const std::str
         if (p) 
         {
             purchasedPlants.push_back(p);
-            std::string biome = p->biome();
-            biomeCount[biome]++;
+            biomeCount[p->biome()]++;
         }
     }
     
@@ -499,8 +634,8 @@ std::vector<Plant*> NurseryFacade::getPersonalizedRecommendations(const std::str
         
         for (auto* p : allPlants) 
         {
-            auto* fly = dynamic_cast<SpeciesFlyweight*>(p->getSpeciesFly());
-            if (fly && fly->getThrivingSeason() == currentSeason) 
+            const PlantFlyweight* fly = p->getSpeciesFly();
+            if (fly && fly->getTraits().careProfile && fly->getTraits().thrivingSeason == currentSeason) 
             {
                 seasonalPlants.push_back(p);
             } 
@@ -546,19 +681,22 @@ std::vector<Plant*> NurseryFacade::getPersonalizedRecommendations(const std::str
     std::vector<std::pair<Plant*, double>> careSimilarPlants; 
     std::vector<Plant*> otherPlants;
     
-    for (auto* candidate : available)
-     {
-        if (purchasedPlantIds.count(candidate->id())) continue;
-        
-        auto* candidateFly = dynamic_cast<SpeciesFlyweight*>(candidate->getSpeciesFly());
-        if (!candidateFly) continue;
+    auto candidates = viewOf(available).where([&purchasedPlantIds](Plant* p)
+    {
+        const PlantFlyweight* fly = p->getSpeciesFly();
+        return fly && fly->getTraits().careProfile && !purchasedPlantIds.count(p->getPlantId());
+    });
+
+    for (Plant* candidate : candidates)
+    {
+        const SpeciesTraits& candidateTraits = candidate->getSpeciesFly()->getTraits();
         
         if (candidate->biome() == favoriteBiome) 
         {
             favoriteBiomePlants.push_back(candidate);
         } 
 
-        else if (candidateFly->getThrivingSeason() == currentSeason) 
+        else if (candidateTraits.thrivingSeason == currentSeason) 
         {
             seasonalPlants.push_back(candidate);
         } 
@@ -568,12 +706,13 @@ std::vector<Plant*> NurseryFacade::getPersonalizedRecommendations(const std::str
             double careScore = 0.0;
             for (auto* purchased : purchasedPlants) 
             {
-                auto* purchasedFly = dynamic_cast<SpeciesFlyweight*>(purchased->getSpeciesFly());
-                if (!purchasedFly) continue;
+                const PlantFlyweight* purchasedFly = purchased->getSpeciesFly();
+                if (!purchasedFly || !purchasedFly->getTraits().careProfile) continue;
+                const SpeciesTraits& purchasedTraits = purchasedFly->getTraits();
                 
-                double waterDiff = std::abs(candidateFly->getWaterSensitivity() - purchasedFly->getWaterSensitivity());
-                double insecticideDiff = std::abs(candidateFly->getInsecticideTolerance() - purchasedFly->getInsecticideTolerance());
-                double growthDiff = std::abs(candidateFly->getGrowthRate() - purchasedFly->getGrowthRate());
+                double waterDiff = std::abs(candidateTraits.waterSensitivity - purchasedTraits.waterSensitivity);
+                double insecticideDiff = std::abs(candidateTraits.insecticideTolerance - purchasedTraits.insecticideTolerance);
+                double growthDiff = std::abs(candidateTraits.growthRate - purchasedTraits.growthRate);
                 
                 if (waterDiff <= 0.1) careScore += 1.0;
                 if (insecticideDiff <= 0.1) careScore += 1.0;
@@ -18,6 +18,7 @@
 #include "SalesService.h"
 #include "StaffService.h"
 #include "ActionLog.h"
+#include "PlantSnapshot.h"
 
 class InventoryService;
 class SalesService;
@@ -26,6 +27,7 @@ class Greenhouse;
 class SpeciesCatalog;
 class PlantRegistry;
 class Plant;
+class PlantState;
 class CustomerService;
 class Staff;
 class Customer;
@@ -61,14 +63,53 @@ public:
      */
     std::vector<Plant*> browseAvailable();
 
+    /**
+     * @brief Get the maintained list of plants available for purchase
+     * @details The list is kept up to date from the inventory's change journal, so a refresh
+     * only touches the plants that were reserved, sold or released since the last call. Nothing
+     * is rebuilt while nothing changed, and callers share the same immutable list.
+     * @return Shared snapshot of the available plants; empty when services are missing
+     */
+    PlantSnapshot availableSnapshot();
+
+    /**
+     * @brief Get the generation of the available plant list
+     * @details A caller that remembers the generation it last drew can skip redrawing until it moves on.
+     * @return Generation of the list availableSnapshot() returns; 0 when services are missing
+     */
+    std::uint64_t availableGeneration();
+
     /**
      * @brief Process a customer checkout transaction
      * @param customerId Unique identifier for the customer
      * @param lines Vector of order line items (plant ID, SKU, description, cost)
      * @param amountPaid Payment amount tendered by customer
+     * @param allOrNothing true to fail the whole checkout if any line cannot be reserved;
+     * otherwise unavailable lines are dropped and the rest is sold
+     * @return Receipt structure with success status, order ID, totals, and change
+     */
+    struct Receipt checkout(std::string customerId, std::vector<events::OrderLine>& lines, double amountPaid, bool allOrNothing = false);
+
+    /**
+     * @brief Buy a quantity of a species without choosing individual plants
+     * @details The plants are reserved straight from the species' stock, so no catalog listing is built.
+     * @param customerId Unique identifier for the customer
+     * @param sku Species SKU to buy
+     * @param quantity Number of plants
+     * @param amountPaid Payment amount tendered by customer
+     * @param healthiestFirst true to pick the healthiest plants; otherwise the longest in stock
      * @return Receipt structure with success status, order ID, totals, and change
      */
-    struct Receipt checkout(std::string customerId, std::vector<events::OrderLine>& lines, double amountPaid);
+    struct Receipt checkoutBySku(std::string customerId, const std::string& sku, int quantity, double amountPaid, bool healthiestFirst = false);
+
+    /**
+     * @brief Get the price checkoutBySku() charges per plant of a species
+     * @details Plants of a species are clones sharing one kit, so this is Plant::cost()
+     * (species, soil and pot) of any of them.
+     * @param sku Species SKU
+     * @return Price of one plant; 0 when the greenhouse holds no plant of that species
+     */
+    double getSkuPrice(const std::string& sku);
 
     /**
      * @brief Retrieve all receipts for a specific customer
@@ -123,6 +164,13 @@ public:
      */
     int getSpeciesQuantity(std::string sku);
 
+    /**
+     * @brief Get the number of plants currently in a lifecycle state
+     * @param state Pointer to the PlantState singleton (e.g. &WiltingState::getInstance())
+     * @return Number of plants in that state in the greenhouse
+     */
+    int getStateCount(const PlantState* state);
+
     /**
      * @brief List all plants in the greenhouse (regardless of availability)
      * @return Vector of pointers to all plants
@@ -295,6 +343,34 @@ public:
     
 private:
 
+    /**
+     * @brief Turn reserved lines into an order and assign it to staff; releases them if the sale fails
+     * @param customerId Unique identifier for the customer
+     * @param lines Order lines whose plants are already reserved
+     * @param amountPaid Payment amount tendered by customer
+     * @return Receipt of the sale
+     */
+    struct Receipt placeOrder(const std::string& customerId, std::vector<events::OrderLine>& lines, double amountPaid);
+
+    /**
+     * @brief Bring the available plant list up to date
+     * @details Applies the inventory's changes since the last refresh in place, copying the list
+     * first if a snapshot of it is still held. The list is rebuilt from scratch when plants joined
+     * or left the greenhouse, or when the inventory no longer has the changes.
+     */
+    void refreshAvailable();
+
+    /// Maintained list of available plants; handed out as a PlantSnapshot
+    std::shared_ptr<std::vector<Plant*>> availableView;
+    /// Position of each plant in availableView, indexed by PlantId handle; may be stale for plants not in it
+    std::vector<std::uint32_t> availablePos;
+    /// Inventory generation availableView reflects
+    std::uint64_t availableInventoryGen = 0;
+    /// Greenhouse membership generation availableView reflects
+    std::uint64_t availableMembershipGen = 0;
+    /// Generation of availableView itself, bumped on every change
+    std::uint64_t availableViewGen = 0;
+
     /// Inventory subsystem: tracks stock levels and plant availability
     InventoryService* inv = nullptr;
     /// Sales subsystem: orders, receipts, and transactions
@@ -12,17 +12,30 @@
 
 #include "Plant.h"
 #include "DeadState.h"
+#include "PlantStore.h"
+#include "PlantArena.h"
 
 
 /// Constructor: initializes all plant components and links shared data.
-Plant::Plant(std::string id, std::string colour, PlantFlyweight* species, CareStrategy* care, PlantState* state, SoilMix* soil, Pot* pot)
+Plant::Plant(PlantId id, std::string colour, PlantFlyweight* species, CareStrategy* care, PlantState* state, SoilMix* soil, Pot* pot)
 : plantId(id), colour(colour), species(species), care(care), state(state), soil(soil), pot(pot) {}
 
-/// Destructor: releases owned resources (soil, pot).
+/// Destructor: gives its store slot back. Soil and pot are shared, so they are left alone.
 Plant::~Plant()
 {
-	delete soil;
-	delete pot;
+	if (store) store->release(slot);
+}
+
+/// Allocates from the arena opened by the Greenhouse, if any.
+void* Plant::operator new(std::size_t size)
+{
+	return PlantArena::allocate(size);
+}
+
+/// Frees to wherever operator new took the memory from.
+void Plant::operator delete(void* p)
+{
+	PlantArena::deallocate(p);
 }
 
 /// Waters the plant using its CareStrategy and checks for state transitions.
@@ -46,14 +59,16 @@ void Plant::sprayInsecticide()
 /// Adds water to the plant, keeping moisture within valid bounds.
 void Plant::addWater(int amount)
 {
-	moistureLevel = check(moistureLevel + amount, 0, 100);
+	int& level = store ? store->moisture(slot) : moistureLevel;
+	level = check(level + amount, 0, 100);
 }
 
 /// Adjusts the plant’s health value within valid limits.
 void Plant::addHealth(int amount)
 {
-	health = check(health + amount, 0, 100);
-	if(health == 0)
+	int& level = store ? store->health(slot) : health;
+	level = check(level + amount, 0, 100);
+	if(level == 0)
 	{
 		this->setState(&DeadState::getInstance());
 	}
@@ -62,7 +77,8 @@ void Plant::addHealth(int amount)
 /// Modifies the insecticide level, keeping insecticide within valid bounds.
 void Plant::addInsecticide(int amount) 
 {
-    insecticideLevel = check(insecticideLevel + amount, 0, 100);
+	int& level = store ? store->insecticide(slot) : insecticideLevel;
+	level = check(level + amount, 0, 100);
 }
 
 /// Computes the total cost of the plant based on its components.
@@ -74,35 +90,36 @@ int Plant::cost()
 /// Updates the plant’s active liceycle state.
 void Plant::setState(PlantState* s)
 {
-	state = s;
+	if (store) store->setState(slot, s);
+	else state = s;
 }
 
 /// Returns the plant’s unique identifier.
-std::string Plant::id() 
+std::string Plant::id() const
 { 
-	return plantId; 
+	return plantId.str(); 
 }
 
 /// Returns the species SKU.
-std::string Plant::sku() 
+const std::string& Plant::sku() const
 {
 	 return species->getSku(); 
 }
 
 /// Returns the species name
-std::string Plant::name() 
+const std::string& Plant::name() const
 { 
 	return species->getName(); 
 }
 
 /// Returns the species biome type.
-std::string Plant::biome() 
+const std::string& Plant::biome() const
 { 
 	return species->getBiome(); 
 }
 
 /// Returns the plant’s color.
-std::string Plant::getColour() 
+const std::string& Plant::getColour() const
 { 
 	return colour;
 }
@@ -118,28 +135,38 @@ std::string Plant::getColour()
 
 int Plant::getAgeDays()  
 {  
-	auto now = std::chrono::system_clock::now();
-    auto diff = std::chrono::duration_cast<std::chrono::seconds>(now - createdAt).count();
-	const double secondsPerSimDay = 10.0;
-    return static_cast<int>(diff / (secondsPerSimDay));
+	return ageDaysBetween(getCreatedAt(), SimClock::current().now());
+}
+
+/// Returns the creation time, from the store when attached.
+std::chrono::system_clock::time_point Plant::getCreatedAt()
+{
+	return store ? store->createdAt(slot) : createdAt;
+}
+
+/// Converts elapsed clock time into simulated days (SimClock::kSecondsPerSimDay seconds per day).
+int Plant::ageDaysBetween(std::chrono::system_clock::time_point born, std::chrono::system_clock::time_point now)
+{
+    auto diff = std::chrono::duration_cast<std::chrono::seconds>(now - born).count();
+    return static_cast<int>(diff / SimClock::kSecondsPerSimDay);
 }
 
 /// Returns the current moisture level.
 int Plant::getMoisture()  
 { 
-	return moistureLevel; 
+	return store ? store->moistureAt(slot) : moistureLevel; 
 }
 
 /// Returns the plant’s health value.
 int Plant::getHealth() 
 { 
-	return health; 
+	return store ? store->healthAt(slot) : health; 
 }
 
 /// Returns the insecticide level.
 int Plant::getInsecticide()  
 { 
-	return insecticideLevel; 
+	return store ? store->insecticideAt(slot) : insecticideLevel; 
 }
 
 /// Returns the species flyweight pointer.
@@ -169,7 +196,19 @@ CareStrategy* Plant::getCareStrategy()
 /// Returns the plant state pointer.
 PlantState*  Plant::getPlantState()    
 { 
-	return state; 
+	return store ? PlantStore::stateAt(store->stateIndex(slot)) : state; 
+}
+
+/// Returns the columnar store backing this plant, if any.
+PlantStore* Plant::getStore()
+{
+	return store;
+}
+
+/// Returns the plant's slot in its store.
+std::uint32_t Plant::getSlot()
+{
+	return slot;
 }
 
 /**
@@ -181,27 +220,37 @@ int Plant::check(int change, int low, int high)
 	return change < low ? low : (change > high ? high : change);
 }
 
-/// Copy constructor used by the Prototype pattern (deep copies soil and pot).
+/// Copy constructor used by the Prototype pattern (shares soil and pot).
+/// The copy is always detached; values of an attached source are read from its store.
 Plant::Plant(const Plant& o) : plantId(o.plantId), colour(o.colour), species(o.species), care(o.care), state(o.state),
-soil(o.soil->clone()), pot (o.pot->clone()), ageInDays(o.ageInDays), moistureLevel(o.moistureLevel), health(o.health), createdAt(o.createdAt), insecticideLevel(o.insecticideLevel)
-{}
+soil(o.soil), pot(o.pot), ageInDays(o.ageInDays), moistureLevel(o.moistureLevel), health(o.health), insecticideLevel(o.insecticideLevel), createdAt(o.createdAt)
+{
+	if (o.store)
+	{
+		moistureLevel = o.store->moistureAt(o.slot);
+		health = o.store->healthAt(o.slot);
+		insecticideLevel = o.store->insecticideAt(o.slot);
+		state = PlantStore::stateAt(o.store->stateIndex(o.slot));
+		createdAt = o.store->createdAt(o.slot);
+	}
+}
 
 /// Clones the plant with a new ID and color for Prototype-based duplication.
-Plant* Plant::clone(std::string newId, std::string col)  
+Plant* Plant::clone(PlantId newId, std::string col)  
 {
     Plant* p = new Plant(*this);  
 	p->colour = col;
-    p->plantId = std::move(newId);
+    p->plantId = newId;
     p->ageInDays = 0; 
     p->moistureLevel = 0;
     p->health = 100;
 	p->insecticideLevel = 100;
-	p->createdAt = std::chrono::system_clock::now();
+	p->createdAt = SimClock::current().now();
     return p;
 }
 
 /**
- * @brief Determines the current simulated season based on the system’s local time.
+ * @brief Determines the current simulated season from the installed SimClock, in local time.
  * 
  * The mapping is simplified: months 3–5 represent Autumn, 6–8 Winter, 9–11 Spring,
  * and remaining months default to Summer. Used for seasonal plant behavior logic.
@@ -210,10 +259,15 @@ Plant* Plant::clone(std::string newId, std::string col)
  */
 
 Season Plant::currentSeason() 
+{
+    return seasonAt(SimClock::current().now());
+}
+
+/// Maps an instant to its season using the same month ranges as currentSeason().
+Season Plant::seasonAt(std::chrono::system_clock::time_point when)
 {
     using namespace std::chrono;
-    auto now = system_clock::now();
-    time_t t = system_clock::to_time_t(now);
+    time_t t = system_clock::to_time_t(when);
     tm localTime;
 #ifdef _WIN32
     localtime_s(&localTime, &t);
@@ -25,10 +25,15 @@
 #include "PlantState.h"
 #include "PlantFlyweight.h"
 #include "DeadState.h"
+#include "SimClock.h"
+#include "PlantId.h"
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 class PlantState;
 class CareStrategy;
 class PlantFlyweight;
+class PlantStore;
 
 /**
  * @class Plant
@@ -46,8 +51,8 @@ class Plant
 
 private:
 
-	/// Unique identifier for the plant.
-	std::string plantId;
+	/// Unique identifier for the plant, interned.
+	PlantId plantId;
 
 	/// Color of the plant
 	std::string colour;
@@ -61,10 +66,10 @@ private:
 	/// Current lifecycle state.
 	PlantState* state;
 
-	/// Composition of the plant's soil type.
+	/// Composition of the plant's soil type (Flyweight, shared by the kit; not owned).
 	SoilMix* soil;
 
-	/// Type of pot the plant is grown in.
+	/// Type of pot the plant is grown in (Flyweight, shared by the kit; not owned).
 	Pot* pot;
 
 	/// Age of the plant in days.
@@ -80,7 +85,16 @@ private:
 	int insecticideLevel = 100; 
 
 	/// Creation timestamp.
-	std::chrono::system_clock::time_point createdAt = std::chrono::system_clock::now();
+	std::chrono::system_clock::time_point createdAt = SimClock::current().now();
+
+	/// Columnar store holding this plant's hot attributes, or nullptr when detached.
+	PlantStore* store = nullptr;
+
+	/// Slot of this plant inside @ref store (only meaningful while attached).
+	std::uint32_t slot = 0;
+
+	/// PlantStore moves the hot attributes in and out of the plant on attach/release.
+	friend class PlantStore;
 
 	/**
      * @brief Constrains a value within a given range.
@@ -100,14 +114,20 @@ public:
      * @param species Pointer to the plant’s flyweight species object.
      * @param care Pointer to the care strategy used for maintenance.
      * @param state Pointer to the plant’s current lifecycle state.
-     * @param soil Pointer to the soil mix used.
-     * @param pot Pointer to the pot used.
+     * @param soil Pointer to the shared soil mix used; must outlive the plant.
+     * @param pot Pointer to the shared pot used; must outlive the plant.
      */
-	Plant(std::string id, std::string colour, PlantFlyweight* species, CareStrategy* care, PlantState* state, SoilMix* soil, Pot* pot);
+	Plant(PlantId id, std::string colour, PlantFlyweight* species, CareStrategy* care, PlantState* state, SoilMix* soil, Pot* pot);
 
-	/// Destructor: cleans up owned resources (soil, pot).
+	/// Destructor: releases its store slot.
 	~Plant();
 
+	/// Allocates a plant from the active PlantArena, or from the heap when none is active.
+	static void* operator new(std::size_t size);
+
+	/// Returns a plant's memory to the arena or heap it came from.
+	static void operator delete(void* p);
+
 	/** @brief Performs watering according to the active CareStrategy. */
 	void water();
 
@@ -135,24 +155,30 @@ public:
 	/** @brief Updates the plant’s current lifecycle state. */
 	void setState(PlantState* s);
 
-	/// Returns the plant’s unique ID.
-	std::string id();
+	/// Returns the plant’s unique ID, formatted as text. Hot paths should use getPlantId().
+	std::string id() const;
+
+	/// Returns the plant’s unique ID as its interned handle.
+	PlantId getPlantId() const { return plantId; }
 
-  	/// Returns the species SKU from the Flyweight.
-  	std::string sku();
+  	/// Returns the species SKU from the Flyweight, without copying it.
+  	const std::string& sku() const;
 
-  	/// Returns the species name.
-  	std::string name();
+  	/// Returns the species name, without copying it.
+  	const std::string& name() const;
 
-	/// Returns the species’ biome type.
-  	std::string biome();
+	/// Returns the species’ biome type, without copying it.
+  	const std::string& biome() const;
 
-	/// Returns the plant’s color.
-  	std::string getColour();
+	/// Returns the plant’s color, without copying it.
+  	const std::string& getColour() const;
 
 	/// Returns the plant’s simulated age in days.
   	int getAgeDays();
 
+	/// Returns the time the plant was created.
+	std::chrono::system_clock::time_point getCreatedAt();
+
 	/// Returns the current moisture level.
   	int getMoisture();
 
@@ -177,16 +203,37 @@ public:
 	/// Returns the associated PlantState pointer.
   	PlantState* getPlantState();
 
+	/// Returns the columnar store this plant is a view of, or nullptr when detached.
+	PlantStore* getStore();
+
+	/// Returns the plant's slot in its store (only meaningful when getStore() is not null).
+	std::uint32_t getSlot();
+
 	/**
-     * @brief Returns the current simulated season based on local time.
+     * @brief Returns the current simulated season based on the SimClock in local time.
      * @return The current Season enum value.
      */
 	static Season currentSeason();
 
+	/**
+     * @brief Returns the simulated season at a given instant.
+     * @param when The instant to classify.
+     * @return The Season enum value for that instant's month.
+     */
+	static Season seasonAt(std::chrono::system_clock::time_point when);
+
+	/**
+     * @brief Converts the wall time between two instants into simulated days.
+     * @param born The plant's creation time.
+     * @param now The instant the age is measured at.
+     * @return Whole simulated days elapsed.
+     */
+	static int ageDaysBetween(std::chrono::system_clock::time_point born, std::chrono::system_clock::time_point now);
+
 
 	/**
      * @brief Copy constructor (supports Prototype behavior).
-     * Performs a deep copy of owned resources (soil, pot).
+     * The copy shares the original's soil mix and pot.
      * @param other The plant to copy from.
      */
 
@@ -198,7 +245,7 @@ public:
      * @param colour New color variation.
      * @return Pointer to the newly cloned plant instance.
      */
-	Plant* clone(std::string plantId, std::string colour);
+	Plant* clone(PlantId plantId, std::string colour);
 };
 
 #endif
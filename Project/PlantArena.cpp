@@ -0,0 +1,136 @@
+/**
+ * @file PlantArena.cpp
+ * @brief Implementation of the SlabPool and PlantArena allocators
+ */
+
+#include "PlantArena.h"
+#include <algorithm>
+#include <new>
+
+namespace
+{
+    /**
+     * @brief Prefix of every block handed out by PlantArena::allocate().
+     * Padded to the maximum alignment so the object after it is suitably aligned.
+     */
+    struct alignas(alignof(std::max_align_t)) BlockHeader
+    {
+        /// Pool the block came from, or nullptr for a heap block.
+        SlabPool* pool;
+    };
+
+    constexpr std::size_t kHeaderSize = sizeof(BlockHeader);
+
+    /// Arena receiving Plant allocations on this thread; set by PlantArena::Scope.
+    thread_local PlantArena* active = nullptr;
+}
+
+SlabPool::SlabPool(std::size_t blockSize) : size(blockSize) {}
+
+SlabPool::~SlabPool()
+{
+    for (void* slab : slabs) ::operator delete(slab);
+}
+
+void* SlabPool::allocate(std::size_t expected)
+{
+    if (!freeList) grow(std::max(kMinSlabBlocks, expected));
+    FreeBlock* block = freeList;
+    freeList = block->next;
+    --available;
+    ++live;
+    return block;
+}
+
+void SlabPool::deallocate(void* block)
+{
+    FreeBlock* freed = static_cast<FreeBlock*>(block);
+    freed->next = freeList;
+    freeList = freed;
+    ++available;
+    --live;
+}
+
+/**
+ * @brief Threads the blocks back to front, so they are handed out in address order
+ */
+void SlabPool::grow(std::size_t blocks)
+{
+    unsigned char* slab = static_cast<unsigned char*>(::operator new(blocks * size));
+    slabs.push_back(slab);
+    for (std::size_t i = blocks; i-- > 0;)
+    {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + i * size);
+        block->next = freeList;
+        freeList = block;
+    }
+    available += blocks;
+}
+
+PlantArena::Scope::Scope(PlantArena& arena, std::size_t expected)
+: arena(arena), previous(active), previousExpected(arena.expected)
+{
+    active = &arena;
+    arena.expected = expected;
+}
+
+PlantArena::Scope::~Scope()
+{
+    arena.expected = previousExpected;
+    active = previous;
+}
+
+PlantArena::~PlantArena() = default;
+
+/**
+ * @brief Rounds the request up to a whole number of headers and serves it from the matching pool
+ */
+void* PlantArena::allocate(std::size_t size)
+{
+    const std::size_t blockSize = (size + 2 * kHeaderSize - 1) / kHeaderSize * kHeaderSize;
+    SlabPool* pool = nullptr;
+    void* raw;
+    if (active && blockSize <= kMaxPooledSize)
+    {
+        pool = &active->poolFor(blockSize);
+        raw = pool->allocate(active->expected);
+    }
+    else
+    {
+        raw = ::operator new(blockSize);
+    }
+    BlockHeader* header = new (raw) BlockHeader{ pool };
+    return header + 1;
+}
+
+void PlantArena::deallocate(void* p)
+{
+    if (!p) return;
+    BlockHeader* header = static_cast<BlockHeader*>(p) - 1;
+    if (header->pool) header->pool->deallocate(header);
+    else ::operator delete(header);
+}
+
+std::size_t PlantArena::slabCount() const
+{
+    std::size_t n = 0;
+    for (const auto& pool : pools)
+        if (pool) n += pool->slabCount();
+    return n;
+}
+
+std::size_t PlantArena::liveCount() const
+{
+    std::size_t n = 0;
+    for (const auto& pool : pools)
+        if (pool) n += pool->liveCount();
+    return n;
+}
+
+SlabPool& PlantArena::poolFor(std::size_t blockSize)
+{
+    const std::size_t sizeClass = blockSize / kHeaderSize;
+    if (pools.size() <= sizeClass) pools.resize(sizeClass + 1);
+    if (!pools[sizeClass]) pools[sizeClass] = std::make_unique<SlabPool>(blockSize);
+    return *pools[sizeClass];
+}
@@ -0,0 +1,214 @@
+/**
+ * @file PlantArena.h
+ * @brief Defines the PlantArena class, a slab pool for Plant objects,
+ * and the SlabPool it is built from.
+ */
+
+#ifndef PLANTARENA_H
+#define PLANTARENA_H
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @class SlabPool
+ * @brief Fixed-size block allocator: blocks are carved out of large slabs and recycled through a free list.
+ *
+ * A slab is one heap allocation holding many blocks. Freed blocks go on an intrusive free list and are
+ * handed out again before a new slab is allocated. Slabs are only freed with the pool.
+ */
+class SlabPool
+{
+
+public:
+
+    /// Fewest blocks a new slab holds.
+    static constexpr std::size_t kMinSlabBlocks = 64;
+
+    /**
+     * @brief Creates an empty pool.
+     * @param blockSize Size of every block, in bytes; a multiple of the maximum alignment.
+     */
+    explicit SlabPool(std::size_t blockSize);
+
+    /// Frees every slab. Blocks still handed out become invalid.
+    ~SlabPool();
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    /**
+     * @brief Hands out a block, taking a new slab if the free list is empty.
+     * @param expected How many blocks the caller expects to take in a row; sizes the new slab if one is needed.
+     * @return The block.
+     */
+    void* allocate(std::size_t expected);
+
+    /**
+     * @brief Puts a block back on the free list.
+     * @param block A block handed out by this pool.
+     */
+    void deallocate(void* block);
+
+    /**
+     * @brief Returns the size of the blocks.
+     * @return Block size in bytes.
+     */
+    std::size_t blockSize() const { return size; }
+
+    /**
+     * @brief Returns the number of slabs allocated so far.
+     * @return The slab count.
+     */
+    std::size_t slabCount() const { return slabs.size(); }
+
+    /**
+     * @brief Returns the number of blocks handed out and not yet given back.
+     * @return The live block count.
+     */
+    std::size_t liveCount() const { return live; }
+
+    /**
+     * @brief Returns the number of blocks waiting on the free list.
+     * @return The free block count.
+     */
+    std::size_t freeCount() const { return available; }
+
+private:
+
+    /// A free block, linked through its first bytes.
+    struct FreeBlock
+    {
+        /// Next free block, or nullptr.
+        FreeBlock* next;
+    };
+
+    /**
+     * @brief Allocates a slab of blocks and threads them onto the free list.
+     * @param blocks Number of blocks in the slab.
+     */
+    void grow(std::size_t blocks);
+
+    /// Size of every block.
+    std::size_t size;
+
+    /// Head of the free list.
+    FreeBlock* freeList = nullptr;
+
+    /// Every slab, for freeing with the pool.
+    std::vector<void*> slabs;
+
+    /// Blocks handed out and not yet given back.
+    std::size_t live = 0;
+
+    /// Blocks on the free list.
+    std::size_t available = 0;
+};
+
+/**
+ * @class PlantArena
+ * @brief Pools the memory of plants, one SlabPool per size class.
+ *
+ * Plant allocates through allocate() and frees through deallocate(). While a Scope is open on a
+ * thread, plants allocated on that thread come from the scope's arena; otherwise they come from the
+ * heap. Each block starts with a small header naming the pool it came from (or none), so
+ * deallocate() returns it to the right place however it was allocated.
+ *
+ * The Greenhouse owns an arena and opens a Scope around receiveShipment(), so a shipment of n plants
+ * costs at most one slab instead of n heap allocations, and plants that die or are sold free
+ * their blocks for the next shipment. The arena must outlive every object allocated from it; the
+ * Greenhouse guarantees this by declaring it before the plants it owns. The arena is not synchronised:
+ * allocate and free its objects from one thread at a time.
+ */
+class PlantArena
+{
+
+public:
+
+    /**
+     * @class Scope
+     * @brief Routes Plant allocations on the calling thread to an arena while it is alive.
+     *
+     * Scopes nest; the previous arena is restored when a scope closes.
+     */
+    class Scope
+    {
+
+    public:
+
+        /**
+         * @brief Opens the scope.
+         * @param arena The arena to allocate from.
+         * @param expected How many plants the scope is expected to create; sizes new slabs.
+         */
+        Scope(PlantArena& arena, std::size_t expected);
+
+        /// Closes the scope and restores the previous arena.
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+
+        /// The arena this scope routes allocations to.
+        PlantArena& arena;
+
+        /// Arena that was active before this scope.
+        PlantArena* previous;
+
+        /// Expected count of the arena before this scope.
+        std::size_t previousExpected;
+    };
+
+    PlantArena() = default;
+    ~PlantArena();
+
+    PlantArena(const PlantArena&) = delete;
+    PlantArena& operator=(const PlantArena&) = delete;
+
+    /**
+     * @brief Allocates memory for a Plant.
+     * @param size Size of the object.
+     * @return Memory from the active arena, or from the heap when no arena is active.
+     */
+    static void* allocate(std::size_t size);
+
+    /**
+     * @brief Frees memory returned by allocate(), to the pool or heap it came from.
+     * @param p The memory; nullptr is ignored.
+     */
+    static void deallocate(void* p);
+
+    /**
+     * @brief Returns the number of slabs allocated across all size classes.
+     * @return The slab count.
+     */
+    std::size_t slabCount() const;
+
+    /**
+     * @brief Returns the number of objects currently allocated from the arena.
+     * @return The live object count.
+     */
+    std::size_t liveCount() const;
+
+private:
+
+    /// Largest object, header included, served from a pool; bigger ones go to the heap.
+    static constexpr std::size_t kMaxPooledSize = 1024;
+
+    /**
+     * @brief Returns the pool for a block size, creating it on first use.
+     * @param blockSize Block size, header included, rounded to the header size.
+     * @return The pool.
+     */
+    SlabPool& poolFor(std::size_t blockSize);
+
+    /// Pools indexed by block size divided by the header size; null until first used.
+    std::vector<std::unique_ptr<SlabPool>> pools;
+
+    /// Plants the open scope expects to create; sizes new slabs.
+    std::size_t expected = 0;
+};
+
+#endif
@@ -13,6 +13,29 @@
  */
 enum class Season { Spring, Summer, Autumn, Winter };
 
+/**
+ * @struct SpeciesTraits
+ * @brief Plain record of the numeric traits of a species, read by the tick and the care strategies
+ *
+ * Traits never change after a flyweight is built, so they are copied into this record once.
+ * Reading it is a plain load: no virtual call and no cast to a concrete flyweight.
+ */
+struct SpeciesTraits
+{
+    /** @brief How strongly watering affects the species. */
+    double waterSensitivity;
+    /** @brief How well the species takes insecticide. */
+    double insecticideTolerance;
+    /** @brief Growth rate; scales the maturity thresholds. */
+    double growthRate;
+    /** @brief Season in which the species grows faster. */
+    Season thrivingSeason;
+    /** @brief Base cost of the species. */
+    int cost;
+    /** @brief true when the flyweight defines care traits (a SpeciesFlyweight); false leaves the numbers at 0. */
+    bool careProfile;
+};
+
 /**
  * @class PlantFlyweight
  * @brief Abstract base class representing the Flyweight interface in the Flyweight design pattern
@@ -35,49 +58,62 @@ public:
      * @brief Gets the SKU (Stock Keeping Unit) identifier for the plant species
      * @return String containing the unique SKU identifier
      */
-    virtual std::string getSku() = 0;
+    virtual const std::string& getSku() const = 0;
 
     /**
      * @brief Gets the name of the plant species
      * @return String containing the species name
      */
-    virtual std::string getName()  = 0;
+    virtual const std::string& getName() const = 0;
 
     /**
      * @brief Gets the biome where the plant species naturally occurs
      * @return String containing the biome information
      */
-    virtual std::string getBiome() = 0;
+    virtual const std::string& getBiome() const = 0;
 
     /**
      * @brief Gets the base cost/price of the plant species
      * @return Integer representing the cost in appropriate currency units
      */
-    virtual int getCost()  = 0;
+    virtual int getCost() const = 0;
 
     /**
      * @brief Gets the water sensitivity of the plant species
      * @return Double value representing how sensitive the plant is to water conditions
      */
-    virtual double getWaterSensitivity()  = 0;
+    virtual double getWaterSensitivity() const = 0;
 
     /**
      * @brief Gets the insecticide tolerance level of the plant species
      * @return Double value representing the plant's tolerance to insecticides
      */
-    virtual double getInsecticideTolerance()  = 0;
+    virtual double getInsecticideTolerance() const = 0;
 
     /**
      * @brief Gets the growth rate of the plant species
      * @return Double value representing the rate at which the plant grows
      */
-    virtual double getGrowthRate()  = 0;
+    virtual double getGrowthRate() const = 0;
 
     /**
      * @brief Gets the season in which the plant species thrives best
      * @return Season enum value indicating the optimal growing season
      */
-    virtual Season getThrivingSeason() = 0;
+    virtual Season getThrivingSeason() const = 0;
+
+    /**
+     * @brief Gets all numeric traits of the species in one plain record
+     * @return Reference to the traits; reading it makes no virtual call
+     */
+    const SpeciesTraits& getTraits() const { return traits; }
+
+protected:
+
+    /**
+     * @brief Traits record, filled in by the concrete flyweight's constructor
+     */
+    SpeciesTraits traits{};
 };
 
 #endif
\ No newline at end of file
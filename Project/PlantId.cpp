@@ -0,0 +1,238 @@
+/**
+ * @file PlantId.cpp
+ * @brief Implementation of the PlantId intern table
+ */
+
+#include "PlantId.h"
+#include "SkuTable.h"
+#include <algorithm>
+#include <charconv>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Process-wide table behind every PlantId.
+     *
+     * entries[handle] says what a handle stands for. Structured ids keep (SpeciesIndex, sequence) and
+     * are found again through the per-SKU bySeq vector, so each costs a dozen bytes. Other ids keep
+     * their text in opaque and are found through opaqueIds.
+     */
+    struct InternTable
+    {
+        /// Marks an entry whose seq field indexes the opaque texts.
+        static constexpr std::uint32_t kOpaque = 0xFFFFFFFFu;
+
+        /// Sequence numbers further than this past the highest one seen are stored as text.
+        static constexpr std::uint32_t kMaxGap = 4096;
+
+        struct Entry
+        {
+            std::uint32_t sku;
+            std::uint32_t seq;
+        };
+
+        std::vector<Entry> entries{ Entry{ kOpaque, 0 } };
+        /// Handle by sequence number, per SpeciesIndex; 0 where the id was never interned.
+        std::vector<std::vector<std::uint32_t>> bySeq;
+        std::vector<std::string> opaque;
+        std::unordered_map<std::string, std::uint32_t> opaqueIds;
+
+        static InternTable& get()
+        {
+            static InternTable table;
+            return table;
+        }
+
+        /// Returns the handle of a structured id, or 0 if seq is too sparse to store that way.
+        std::uint32_t structured(SpeciesIndex sku, std::uint32_t seq)
+        {
+            if (bySeq.size() <= sku) bySeq.resize(sku + 1);
+            std::vector<std::uint32_t>& seqs = bySeq[sku];
+            if (seq >= seqs.size())
+            {
+                if (seq - seqs.size() > kMaxGap) return 0;
+                seqs.resize(seq + 1, 0);
+            }
+            std::uint32_t& handle = seqs[seq];
+            if (handle == 0)
+            {
+                // The same text may have been stored opaquely while its sequence was still too sparse.
+                if (!opaque.empty() && (handle = opaqueHandle(sku, seq)) != 0) return handle;
+                handle = static_cast<std::uint32_t>(entries.size());
+                entries.push_back(Entry{ sku, seq });
+            }
+            return handle;
+        }
+
+        /// Returns the handle of "sku#seq" if it was interned as text, or 0.
+        std::uint32_t opaqueHandle(SpeciesIndex sku, std::uint32_t seq) const;
+
+        /// Grows the tables once for a block of structured ids; the ids are interned by the caller.
+        void reserveRange(SpeciesIndex sku, std::uint32_t first, std::uint32_t count)
+        {
+            if (bySeq.size() <= sku) bySeq.resize(sku + 1);
+            std::vector<std::uint32_t>& seqs = bySeq[sku];
+            const std::uint32_t end = first + count;
+            if (end > seqs.size() && first <= seqs.size() + kMaxGap) seqs.resize(end, 0);
+            // Grow geometrically: an exact reserve per block would recopy the table on every batch.
+            const std::size_t need = entries.size() + count;
+            if (need > entries.capacity()) entries.reserve(std::max(need, entries.capacity() * 2));
+        }
+
+        std::uint32_t text(const std::string& id)
+        {
+            auto it = opaqueIds.find(id);
+            if (it != opaqueIds.end()) return it->second;
+            std::uint32_t handle = static_cast<std::uint32_t>(entries.size());
+            entries.push_back(Entry{ kOpaque, static_cast<std::uint32_t>(opaque.size()) });
+            opaque.push_back(id);
+            opaqueIds.emplace(id, handle);
+            return handle;
+        }
+
+        /// Splits "SKU#n" into the position of '#' and n; false for any other shape.
+        static bool parse(const std::string& id, std::size_t& hash, std::uint32_t& seq)
+        {
+            // "SKU#n" with n a plain positive number (no sign, no leading zero) round-trips exactly.
+            hash = id.rfind('#');
+            std::size_t digits = id.size() - hash - 1;
+            if (hash == std::string::npos || hash == 0 || digits == 0 || digits > 9 || id[hash + 1] == '0') return false;
+            seq = 0;
+            for (std::size_t i = hash + 1; i < id.size(); ++i)
+            {
+                if (id[i] < '0' || id[i] > '9') return false;
+                seq = seq * 10 + static_cast<std::uint32_t>(id[i] - '0');
+            }
+            return true;
+        }
+
+        std::uint32_t intern(const std::string& id)
+        {
+            if (id.empty()) return 0;
+
+            std::size_t hash;
+            std::uint32_t seq;
+            if (parse(id, hash, seq))
+            {
+                std::uint32_t handle = structured(SkuTable::intern(id.substr(0, hash)), seq);
+                if (handle) return handle;
+            }
+            return text(id);
+        }
+
+        /// Returns the handle of an id that was already interned, or 0; adds nothing to any table.
+        std::uint32_t find(const std::string& id) const
+        {
+            if (id.empty()) return 0;
+
+            std::size_t hash;
+            std::uint32_t seq;
+            if (parse(id, hash, seq))
+            {
+                const SpeciesIndex sku = SkuTable::find(id.substr(0, hash));
+                if (sku < bySeq.size() && seq < bySeq[sku].size() && bySeq[sku][seq] != 0) return bySeq[sku][seq];
+            }
+            auto it = opaqueIds.find(id);
+            return it == opaqueIds.end() ? 0 : it->second;
+        }
+    };
+
+    /// Appends "sku#seq" to out, formatting seq with std::to_chars.
+    void appendStructured(std::string& out, SpeciesIndex sku, std::uint32_t seq)
+    {
+        char digits[10];
+        std::to_chars_result r = std::to_chars(digits, digits + sizeof digits, seq);
+        out += SkuTable::name(sku);
+        out += '#';
+        out.append(digits, r.ptr);
+    }
+
+    std::uint32_t InternTable::opaqueHandle(SpeciesIndex sku, std::uint32_t seq) const
+    {
+        std::string text;
+        appendStructured(text, sku, seq);
+        auto it = opaqueIds.find(text);
+        return it == opaqueIds.end() ? 0 : it->second;
+    }
+}
+
+PlantId::PlantId(const std::string& text) : handle(InternTable::get().intern(text)) {}
+
+PlantId::PlantId(const char* text) : PlantId(std::string(text ? text : "")) {}
+
+PlantId PlantId::find(const std::string& text)
+{
+    PlantId id;
+    id.handle = InternTable::get().find(text);
+    return id;
+}
+
+PlantId PlantId::make(const std::string& sku, std::uint32_t seq)
+{
+    if (sku.empty()) return PlantId("#" + std::to_string(seq));
+    return make(SkuTable::intern(sku), seq);
+}
+
+PlantId PlantId::make(SpeciesIndex species, std::uint32_t seq)
+{
+    PlantId id;
+    if (seq > 0) id.handle = InternTable::get().structured(species, seq);
+    if (!id.valid())
+    {
+        std::string text;
+        appendStructured(text, species, seq);
+        id = PlantId(text);
+    }
+    return id;
+}
+
+std::string PlantId::str() const
+{
+    std::string out;
+    appendTo(out);
+    return out;
+}
+
+void PlantId::appendTo(std::string& out) const
+{
+    if (handle == 0) return;
+    const InternTable& table = InternTable::get();
+    const InternTable::Entry& e = table.entries[handle];
+    if (e.sku == InternTable::kOpaque) out += table.opaque[e.seq];
+    else appendStructured(out, e.sku, e.seq);
+}
+
+PlantIdRange::PlantIdRange(SpeciesIndex species, std::uint32_t first, std::uint32_t count)
+: species(species), first(first), count(count)
+{
+    if (count == 0) return;
+    InternTable::get().reserveRange(species, first, count);
+    for (std::uint32_t i = 0; i < count; ++i) PlantId::make(species, first + i);
+}
+
+PlantId PlantIdGenerator::next(SpeciesIndex species)
+{
+    if (lastSeq.size() <= species) lastSeq.resize(species + 1, 0);
+    return PlantId::make(species, ++lastSeq[species]);
+}
+
+PlantIdRange PlantIdGenerator::reserve(SpeciesIndex species, std::uint32_t count)
+{
+    if (lastSeq.size() <= species) lastSeq.resize(species + 1, 0);
+    const std::uint32_t first = lastSeq[species] + 1;
+    lastSeq[species] += count;
+    return PlantIdRange(species, first, count);
+}
+
+std::uint32_t PlantIdGenerator::issued(SpeciesIndex species) const
+{
+    return species < lastSeq.size() ? lastSeq[species] : 0;
+}
+
+std::ostream& operator<<(std::ostream& os, const PlantId& id)
+{
+    return os << id.str();
+}
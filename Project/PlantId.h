@@ -0,0 +1,239 @@
+/**
+ * @file PlantId.h
+ * @brief Defines the PlantId class, a 32-bit interned handle for plant identifiers.
+ */
+
+#ifndef PLANTID_H
+#define PLANTID_H
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "SkuTable.h"
+
+/**
+ * @class PlantId
+ * @brief Compact plant identifier: an index into a process-wide intern table.
+ *
+ * Ids of the form "SKU#n" (the ones the Greenhouse hands out) are stored as a SpeciesIndex and a
+ * sequence number, so no per-plant string is kept. Any other text is stored once as is. Two
+ * PlantIds are equal exactly when their text is equal, and comparing, hashing and copying them
+ * never touches a string. The text is only rebuilt by str(), for the GUI and for logs.
+ *
+ * Constructing a PlantId from text interns it, and interned entries are never freed, so lookups
+ * of text from outside go through find() instead. The table is not synchronised: intern from one
+ * thread at a time. Reading existing ids (str(), comparisons) is safe from any thread as long as
+ * nothing is being interned.
+ */
+class PlantId
+{
+
+public:
+
+    /**
+     * @brief Creates the empty id, which refers to no plant.
+     */
+    PlantId() = default;
+
+    /**
+     * @brief Interns a plant id given as text.
+     * Only for code that creates ids; to look one up, use find(), which never adds an entry.
+     * @param text The id, e.g. "ROSE001#3". The empty string gives the empty id.
+     */
+    explicit PlantId(const std::string& text);
+
+    /**
+     * @brief Interns a plant id given as text.
+     * @param text The id, e.g. "ROSE001#3".
+     */
+    explicit PlantId(const char* text);
+
+    /**
+     * @brief Looks up a plant id given as text without interning it.
+     * Use this wherever text comes from outside (the GUI, a customer, a file): an unknown id adds
+     * nothing to the intern table or to the SkuTable.
+     * @param text The id, e.g. "ROSE001#3".
+     * @return The id, or the empty id if that text was never interned.
+     */
+    static PlantId find(const std::string& text);
+
+    /**
+     * @brief Interns the id "sku#seq" without building its text.
+     * @param sku The species SKU.
+     * @param seq The per-SKU sequence number, starting at 1.
+     * @return The id.
+     */
+    static PlantId make(const std::string& sku, std::uint32_t seq);
+
+    /**
+     * @brief Interns the id "sku#seq" for an already interned SKU.
+     * @param species The species' index in the SkuTable.
+     * @param seq The per-SKU sequence number, starting at 1.
+     * @return The id.
+     */
+    static PlantId make(SpeciesIndex species, std::uint32_t seq);
+
+    /**
+     * @brief Formats the id as text.
+     * @return The human-readable id, or "" for the empty id.
+     */
+    std::string str() const;
+
+    /**
+     * @brief Appends the formatted id to a string.
+     *
+     * The sequence number is written with std::to_chars, and nothing else is allocated, so a
+     * caller that reuses @p out across many ids formats them at memory speed.
+     *
+     * @param out The buffer to append to.
+     */
+    void appendTo(std::string& out) const;
+
+    /**
+     * @brief Returns the raw handle.
+     * @return The handle; 0 for the empty id.
+     */
+    std::uint32_t value() const { return handle; }
+
+    /**
+     * @brief Checks whether the id refers to a plant.
+     * @return false for the empty id.
+     */
+    bool valid() const { return handle != 0; }
+
+    bool operator==(const PlantId& o) const { return handle == o.handle; }
+    bool operator!=(const PlantId& o) const { return handle != o.handle; }
+
+    /**
+     * @brief Orders ids by interning order, not by text.
+     */
+    bool operator<(const PlantId& o) const { return handle < o.handle; }
+
+private:
+
+    /// Index into the intern table; 0 is the empty id.
+    std::uint32_t handle = 0;
+};
+
+/**
+ * @class PlantIdRange
+ * @brief A block of consecutive ids "sku#first" .. "sku#(first + size() - 1)" of one species.
+ *
+ * Constructing a range interns all of its ids in one pass, growing the intern table once for the
+ * whole block. After that, operator[] only looks the id up and never allocates.
+ */
+class PlantIdRange
+{
+
+public:
+
+    /**
+     * @brief Creates an empty range.
+     */
+    PlantIdRange() = default;
+
+    /**
+     * @brief Interns the ids of a block.
+     * @param species The species' index in the SkuTable.
+     * @param first Sequence number of the first id, starting at 1.
+     * @param count Number of ids in the block.
+     */
+    PlantIdRange(SpeciesIndex species, std::uint32_t first, std::uint32_t count);
+
+    /**
+     * @brief Returns an id of the block.
+     * @param i Position in the block, below size().
+     * @return The id "sku#(first + i)".
+     */
+    PlantId operator[](std::uint32_t i) const { return PlantId::make(species, first + i); }
+
+    /**
+     * @brief Returns the number of ids in the block.
+     * @return The block size.
+     */
+    std::uint32_t size() const { return count; }
+
+    /**
+     * @brief Returns the sequence number of the first id.
+     * @return The first sequence number.
+     */
+    std::uint32_t firstSeq() const { return first; }
+
+    /**
+     * @brief Returns the species the ids belong to.
+     * @return The species' index in the SkuTable.
+     */
+    SpeciesIndex getSpecies() const { return species; }
+
+private:
+
+    /// Species of every id in the block.
+    SpeciesIndex species = kNoSpecies;
+
+    /// Sequence number of the first id.
+    std::uint32_t first = 0;
+
+    /// Number of ids.
+    std::uint32_t count = 0;
+};
+
+/**
+ * @class PlantIdGenerator
+ * @brief Hands out plant ids per SKU in sequence: "sku#1", "sku#2", ...
+ *
+ * Each species keeps its own counter in a flat array indexed by SpeciesIndex. Ids are interned
+ * directly from (species, sequence), so no text is built. A batch can claim a whole range at once
+ * with reserve().
+ */
+class PlantIdGenerator
+{
+
+public:
+
+    /**
+     * @brief Returns the next id of a species.
+     * @param species The species' index in the SkuTable.
+     * @return The id "sku#n", n one past the last sequence number handed out.
+     */
+    PlantId next(SpeciesIndex species);
+
+    /**
+     * @brief Claims the next block of ids of a species and interns them together.
+     * @param species The species' index in the SkuTable.
+     * @param count Number of ids to claim.
+     * @return The claimed range.
+     */
+    PlantIdRange reserve(SpeciesIndex species, std::uint32_t count);
+
+    /**
+     * @brief Returns how many ids of a species have been handed out.
+     * @param species The species' index in the SkuTable.
+     * @return The last sequence number handed out, or 0.
+     */
+    std::uint32_t issued(SpeciesIndex species) const;
+
+private:
+
+    /// Last sequence number handed out, indexed by SpeciesIndex.
+    std::vector<std::uint32_t> lastSeq;
+};
+
+/**
+ * @brief Writes the formatted id to a stream.
+ */
+std::ostream& operator<<(std::ostream& os, const PlantId& id);
+
+namespace std
+{
+    /**
+     * @brief Hashes a PlantId by its handle.
+     */
+    template <>
+    struct hash<PlantId>
+    {
+        std::size_t operator()(const PlantId& id) const noexcept { return id.value(); }
+    };
+}
+
+#endif
@@ -2,9 +2,7 @@
 
 Plant* PlantKitFactory::createPlant(std::string id, std::string colour, PlantFlyweight* sf)
 {
-    Pot* pot = createPot();
-    SoilMix* soil = createSoilMix();
     CareStrategy* care = careStrategy();
     PlantState* state = &SeedlingState::getInstance();
-    return new Plant(id, colour, sf, care, state, soil, pot);
+    return new Plant(PlantId(id), colour, sf, care, state, soilMix(), pot());
 }
\ No newline at end of file
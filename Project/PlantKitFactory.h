@@ -25,7 +25,8 @@
  * @brief Abstract factory for creating plants and their associated components.
  * 
  * Provides the interface for creating Plant objects along with environment-specific
- * Pot, SoilMix, and CareStrategy. Uses the Factory Method pattern.
+ * Pot, SoilMix, and CareStrategy. Uses the Factory Method pattern. Pots, soil mixes and
+ * care strategies are shared by all plants of a kit, like the species flyweights.
  */
 class PlantKitFactory 
 {
@@ -49,16 +50,16 @@ public:
 protected:
 
     /**
-     * @brief Creates a pot suitable for this plant type.
-     * @return Pointer to a Pot object.
+     * @brief Returns the pot suitable for this plant type.
+     * @return Pointer to a Pot flyweight shared by every plant of the kit; never owned by the caller.
      */
-    virtual Pot* createPot() = 0;
+    virtual Pot* pot() = 0;
 
     /**
-     * @brief Creates a soil mix suitable for this plant type.
-     * @return Pointer to a SoilMix object.
+     * @brief Returns the soil mix suitable for this plant type.
+     * @return Pointer to a SoilMix flyweight shared by every plant of the kit; never owned by the caller.
      */
-    virtual SoilMix* createSoilMix() = 0;
+    virtual SoilMix* soilMix() = 0;
 };
 
 #endif
@@ -0,0 +1,211 @@
+/**
+ * @file PlantRange.h
+ * @brief Defines PlantRange, a non-owning, allocation-free view of Plant pointers, and the
+ * iterators behind the Greenhouse plant views.
+ */
+
+#ifndef PLANTRANGE_H
+#define PLANTRANGE_H
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+class Plant;
+
+/**
+ * @class SlotPlantIterator
+ * @brief Walks a list of store slots and yields the plant viewing each one.
+ */
+class SlotPlantIterator
+{
+
+public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Plant*;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Plant* const*;
+    using reference = Plant*;
+
+    SlotPlantIterator() = default;
+
+    /**
+     * @brief Creates an iterator at a position of a slot list.
+     * @param slot Position in the slot list.
+     * @param owners The store's plant column, indexed by slot.
+     */
+    SlotPlantIterator(const std::uint32_t* slot, Plant* const* owners) : slot(slot), owners(owners) {}
+
+    Plant* operator*() const { return owners[*slot]; }
+    SlotPlantIterator& operator++() { ++slot; return *this; }
+    SlotPlantIterator operator++(int) { SlotPlantIterator old = *this; ++slot; return old; }
+    bool operator==(const SlotPlantIterator& o) const { return slot == o.slot; }
+    bool operator!=(const SlotPlantIterator& o) const { return slot != o.slot; }
+
+private:
+
+    /// Current position in the slot list.
+    const std::uint32_t* slot = nullptr;
+
+    /// The store's plant column.
+    Plant* const* owners = nullptr;
+};
+
+/**
+ * @class OccupiedPlantIterator
+ * @brief Walks the store's plant column in slot order, skipping vacant slots.
+ */
+class OccupiedPlantIterator
+{
+
+public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Plant*;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Plant* const*;
+    using reference = Plant*;
+
+    OccupiedPlantIterator() = default;
+
+    /**
+     * @brief Creates an iterator at the first occupied slot at or after @p at.
+     * @param at Position in the plant column.
+     * @param last One past the last slot.
+     */
+    OccupiedPlantIterator(Plant* const* at, Plant* const* last) : at(at), last(last) { skipVacant(); }
+
+    Plant* operator*() const { return *at; }
+    OccupiedPlantIterator& operator++() { ++at; skipVacant(); return *this; }
+    OccupiedPlantIterator operator++(int) { OccupiedPlantIterator old = *this; ++*this; return old; }
+    bool operator==(const OccupiedPlantIterator& o) const { return at == o.at; }
+    bool operator!=(const OccupiedPlantIterator& o) const { return at != o.at; }
+
+private:
+
+    /// Advances past vacant slots.
+    void skipVacant() { while (at != last && !*at) ++at; }
+
+    /// Current slot.
+    Plant* const* at = nullptr;
+
+    /// One past the last slot.
+    Plant* const* last = nullptr;
+};
+
+/**
+ * @class FilterPlantIterator
+ * @brief Wraps a plant iterator and skips the plants a predicate rejects.
+ *
+ * The predicate is kept by value, so the iterator stays valid however the range that made it
+ * was chained.
+ */
+template <typename It, typename Pred>
+class FilterPlantIterator
+{
+
+public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Plant*;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Plant* const*;
+    using reference = Plant*;
+
+    /**
+     * @brief Creates an iterator at the first accepted plant at or after @p at.
+     * @param at Position in the underlying range.
+     * @param last End of the underlying range.
+     * @param pred Returns true for the plants to yield.
+     */
+    FilterPlantIterator(It at, It last, Pred pred) : at(at), last(last), pred(std::move(pred)) { skipRejected(); }
+
+    Plant* operator*() const { return *at; }
+    FilterPlantIterator& operator++() { ++at; skipRejected(); return *this; }
+    bool operator==(const FilterPlantIterator& o) const { return at == o.at; }
+    bool operator!=(const FilterPlantIterator& o) const { return at != o.at; }
+
+private:
+
+    /// Advances past the plants the predicate rejects.
+    void skipRejected() { while (at != last && !pred(*at)) ++at; }
+
+    /// Current position.
+    It at;
+
+    /// End of the underlying range.
+    It last;
+
+    /// Returns true for the plants to yield.
+    Pred pred;
+};
+
+/**
+ * @class PlantRange
+ * @brief A pair of plant iterators usable in a range-based for loop.
+ *
+ * A range owns nothing and allocates nothing: walking it reads the underlying list directly, and
+ * every step is an inlined pointer increment instead of a virtual Iterator call. where() narrows
+ * the range with a predicate and can be chained.
+ *
+ * Ranges over the Greenhouse read its live index. Do not add, remove or change the state of
+ * plants while walking one; collect what you need first (or use a snapshot iterator).
+ */
+template <typename It>
+class PlantRange
+{
+
+public:
+
+    using iterator = It;
+
+    /**
+     * @brief Creates a range.
+     * @param first First position.
+     * @param last One past the last position.
+     */
+    PlantRange(It first, It last) : first(first), last(last) {}
+
+    It begin() const { return first; }
+    It end() const { return last; }
+
+    /**
+     * @brief Checks whether the range yields no plant.
+     * @return true if begin() == end().
+     */
+    bool empty() const { return first == last; }
+
+    /**
+     * @brief Narrows the range to the plants a predicate accepts.
+     * @param pred Callable taking a Plant* and returning true for the plants to keep.
+     * @return The filtered range; evaluated lazily while walking it.
+     */
+    template <typename Pred>
+    PlantRange<FilterPlantIterator<It, Pred>> where(Pred pred) const
+    {
+        using Filtered = FilterPlantIterator<It, Pred>;
+        return PlantRange<Filtered>(Filtered(first, last, pred), Filtered(last, last, pred));
+    }
+
+private:
+
+    /// First position.
+    It first;
+
+    /// One past the last position.
+    It last;
+};
+
+/**
+ * @brief Views an existing container of Plant pointers as a PlantRange.
+ * @param plants The container; must outlive the range.
+ * @return The range over it.
+ */
+template <typename Container>
+PlantRange<typename Container::const_iterator> viewOf(const Container& plants)
+{
+    return PlantRange<typename Container::const_iterator>(plants.begin(), plants.end());
+}
+
+#endif
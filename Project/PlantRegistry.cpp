@@ -2,26 +2,76 @@
 
 void PlantRegistry::registerSeedling(std::string sku, std::unique_ptr<Plant> p) 
 {
-    bySku[sku] = std::move(p);
+    SpeciesIndex species = SkuTable::intern(sku);
+    if (bySku.size() <= species)
+    {
+        bySku.resize(species + 1);
+        registered.resize(species + 1, false);
+    }
+    bySku[species] = std::move(p);
+    registered[species] = true;
+}
+
+Plant* PlantRegistry::clone(std::string sku, PlantId newId, std::string colour) 
+{
+    return clone(SkuTable::find(sku), newId, std::move(colour));
+}
+
+Plant* PlantRegistry::clone(SpeciesIndex species, PlantId newId, std::string colour) 
+{
+    Plant* proto = prototypeOf(species);
+    return proto ? proto->clone(newId, std::move(colour)) : nullptr;
+}
+
+std::size_t PlantRegistry::cloneBatch(const std::string& sku, std::size_t count, std::vector<Plant*>& out,
+                                      std::uint32_t firstSeq, const std::vector<std::string>& colours)
+{
+    return cloneBatch(SkuTable::find(sku), count, out, firstSeq, colours);
 }
 
-Plant* PlantRegistry::clone(std::string sku, std::string newId, std::string colour) 
+std::size_t PlantRegistry::cloneBatch(SpeciesIndex species, std::size_t count, std::vector<Plant*>& out,
+                                      std::uint32_t firstSeq, const std::vector<std::string>& colours)
 {
-    auto it = bySku.find(sku);
-    if (it == bySku.end()) 
+    if (count == 0 || !prototypeOf(species)) return 0;
+    return cloneBatch(PlantIdRange(species, firstSeq, static_cast<std::uint32_t>(count)), out, colours);
+}
+
+std::size_t PlantRegistry::cloneBatch(const PlantIdRange& ids, std::vector<Plant*>& out, const std::vector<std::string>& colours)
+{
+    Plant* proto = prototypeOf(ids.getSpecies());
+    if (!proto) return 0;
+
+    out.reserve(out.size() + ids.size());
+    const std::size_t palette = colours.size();
+    for (std::uint32_t i = 0; i < ids.size(); ++i)
+    {
+        out.push_back(proto->clone(ids[i], colours[i % palette]));
+    }
+    return ids.size();
+}
+
+Plant* PlantRegistry::prototypeOf(SpeciesIndex species)
+{
+    if (species >= registered.size() || !registered[species]) 
     {
         std::cerr << "SKU not found\n";
         return nullptr;
     }
-    if (!it->second) 
+    if (!bySku[species]) 
     {
-        std::cerr << "Registry entry is null for " << sku << "\n";
+        std::cerr << "Registry entry is null for " << SkuTable::name(species) << "\n";
         return nullptr;
     }
-    return it->second->clone(newId, colour);
+    return bySku[species].get();
+}
+
+bool PlantRegistry::canClone(SpeciesIndex species) const
+{
+    return species < registered.size() && registered[species] && bySku[species];
 }
 
 bool PlantRegistry::has(std::string sku) 
 { 
-    return bySku.count(sku) != 0; 
+    SpeciesIndex species = SkuTable::find(sku);
+    return species < registered.size() && registered[species]; 
 }
\ No newline at end of file
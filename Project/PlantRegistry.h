@@ -5,7 +5,7 @@
 
 #ifndef PLANTREGISTRY_H
 #define PLANTREGISTRY_H
-#include <unordered_map>
+#include <vector>
 #include <memory>
 #include <string>
 #include "Plant.h"
@@ -44,7 +44,57 @@ public:
      * @return A raw pointer to the newly created and initialized Plant instance, or nullptr if the SKU is not registered.
      */
 
-    Plant* clone(std::string sku, std::string newId, std::string colour);
+    Plant* clone(std::string sku, PlantId newId, std::string colour);
+
+    /**
+     * @brief Creates a new Plant instance by cloning the prototype of an interned species.
+     * @param species The species' index in the SkuTable.
+     * @param newId The unique identifier to assign to the new cloned Plant instance.
+     * @param colour The color string to assign to the new cloned Plant instance.
+     * @return A raw pointer to the new Plant instance, or nullptr if the species is not registered.
+     */
+
+    Plant* clone(SpeciesIndex species, PlantId newId, std::string colour);
+
+    /**
+     * @brief Clones the registered prototype of a SKU several times in one pass.
+     *
+     * The prototype is looked up once. Clone i gets the id "sku#(firstSeq + i)" and the colour
+     * colours[i % colours.size()].
+     *
+     * @param sku The Stock Keeping Unit of the prototype to clone.
+     * @param count The number of clones to make.
+     * @param out Receives the new Plant instances; the caller takes ownership of them.
+     * @param firstSeq The sequence number of the first clone's id.
+     * @param colours The colours to cycle through; must not be empty.
+     * @return The number of clones appended to @p out: @p count, or 0 if the SKU is not registered.
+     */
+
+    std::size_t cloneBatch(const std::string& sku, std::size_t count, std::vector<Plant*>& out,
+                           std::uint32_t firstSeq, const std::vector<std::string>& colours);
+
+    /**
+     * @brief Clones the prototype of an interned species several times in one pass.
+     * @param species The species' index in the SkuTable.
+     * @param count The number of clones to make.
+     * @param out Receives the new Plant instances; the caller takes ownership of them.
+     * @param firstSeq The sequence number of the first clone's id.
+     * @param colours The colours to cycle through; must not be empty.
+     * @return The number of clones appended to @p out: @p count, or 0 if the species is not registered.
+     */
+
+    std::size_t cloneBatch(SpeciesIndex species, std::size_t count, std::vector<Plant*>& out,
+                           std::uint32_t firstSeq, const std::vector<std::string>& colours);
+
+    /**
+     * @brief Clones the prototype of a species once per id of an already interned range.
+     * @param ids The ids to give the clones, in order (see PlantIdGenerator::reserve()).
+     * @param out Receives the new Plant instances; the caller takes ownership of them.
+     * @param colours The colours to cycle through; must not be empty.
+     * @return The number of clones appended to @p out: ids.size(), or 0 if the species is not registered.
+     */
+
+    std::size_t cloneBatch(const PlantIdRange& ids, std::vector<Plant*>& out, const std::vector<std::string>& colours);
 
     /**
      * @brief Checks if a prototype Plant is registered under the given SKU.
@@ -54,14 +104,36 @@ public:
 
     bool has(std::string sku);
 
+    /**
+     * @brief Checks whether clones of a species can be made, without reporting anything.
+     * @param species The species' index in the SkuTable, or kNoSpecies.
+     * @return true if a non-null prototype is registered for the species.
+     */
+
+    bool canClone(SpeciesIndex species) const;
+
 private:
 
 /**
- * @brief The map storing the prototype Plant objects, keyed by species SKU.
+ * @brief Returns the prototype of a species, reporting a missing or null entry on std::cerr.
+ * @param species The species' index in the SkuTable.
+ * @return The prototype, or nullptr if there is none to clone.
+ */
+
+    Plant* prototypeOf(SpeciesIndex species);
+
+/**
+ * @brief The prototype Plant objects, indexed by SpeciesIndex.
  * Unique pointers ensure proper ownership and memory management of the prototypes.
  */
 
-    std::unordered_map<std::string, std::unique_ptr<Plant>> bySku;
+    std::vector<std::unique_ptr<Plant>> bySku;
+
+/**
+ * @brief Whether a SKU has been registered, indexed by SpeciesIndex. A registered prototype may be null.
+ */
+
+    std::vector<bool> registered;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,23 @@
+/**
+ * @file PlantSnapshot.h
+ * @brief Defines PlantSnapshot, an immutable, shared generation of a list of plants.
+ */
+
+#ifndef PLANTSNAPSHOT_H
+#define PLANTSNAPSHOT_H
+#include <memory>
+#include <vector>
+
+class Plant;
+
+/**
+ * @brief An immutable list of plants, shared by every iterator created from it.
+ *
+ * The Greenhouse builds a snapshot the first time one is asked for and hands the same one out
+ * until its plants change. A mutation never touches an existing snapshot: the next request builds
+ * a new generation, and iterators still holding the old one keep it alive. Pointers in an old
+ * snapshot are only safe to use while those plants are still in the greenhouse.
+ */
+using PlantSnapshot = std::shared_ptr<const std::vector<Plant*>>;
+
+#endif
@@ -7,6 +7,7 @@
 #ifndef PLANTSTATE_H
 #define PLANTSTATE_H
 #include <string>
+#include "TickContext.h"
 
 class Plant;
 
@@ -32,11 +33,18 @@ public:
     /**
 	 * @brief Checks and potentially changes the plant's state based on current conditions
 	 * @param plant Reference to the Plant object whose state is being managed
+	 * @param context Time, season and thresholds shared by every plant in the same tick
 	 *
 	 * This method evaluates the plant's current attributes (health, moisture, insecticide, age)
 	 * and transitions to an appropriate state if conditions warrant a change.
 	 */
-    virtual void checkChange(Plant& plant) = 0;
+    virtual void checkChange(Plant& plant, const TickContext& context) = 0;
+
+    /**
+	 * @brief Checks a single plant against the current time and season
+	 * @param plant Reference to the Plant object whose state is being managed
+	 */
+    void checkChange(Plant& plant) { checkChange(plant, TickContext()); }
 
     /**
 	 * @brief Gets the name of the current state
@@ -0,0 +1,239 @@
+/**
+ * @file PlantStore.cpp
+ * @brief Implementation of the PlantStore columnar plant storage
+ */
+
+#include "PlantStore.h"
+#include "Plant.h"
+#include "SeedlingState.h"
+#include "GrowingState.h"
+#include "MatureState.h"
+#include "WiltingState.h"
+#include "DeadState.h"
+#include "TickKernel.h"
+#include <algorithm>
+
+/**
+ * @brief Free slots are reused first, so only the rest need new column space. Growth stays
+ * geometric so that many small batches do not recopy the columns each time.
+ */
+void PlantStore::reserve(std::size_t count)
+{
+    if (count <= freeSlots.size()) return;
+    std::size_t slots = owners.size() + count - freeSlots.size();
+    if (slots <= owners.capacity()) return;
+    slots = std::max(slots, owners.capacity() * 2);
+    moistureCol.reserve(slots);
+    healthCol.reserve(slots);
+    insecticideCol.reserve(slots);
+    stateCol.reserve(slots);
+    speciesCol.reserve(slots);
+    createdCol.reserve(slots);
+    owners.reserve(slots);
+    bucketPosition.reserve(slots);
+}
+
+/**
+ * @brief Moves the hot attributes of a plant into the store
+ *
+ * Reuses a released slot when one is available, otherwise grows every column by one.
+ * From here on the plant's accessors are served from the columns.
+ */
+std::uint32_t PlantStore::attach(Plant* plant)
+{
+    std::uint32_t slot;
+    if (!freeSlots.empty())
+    {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<std::uint32_t>(owners.size());
+        moistureCol.push_back(0);
+        healthCol.push_back(0);
+        insecticideCol.push_back(0);
+        stateCol.push_back(kVacant);
+        speciesCol.push_back(0);
+        createdCol.emplace_back();
+        owners.push_back(nullptr);
+        bucketPosition.push_back(0);
+    }
+
+    moistureCol[slot] = plant->moistureLevel;
+    healthCol[slot] = plant->health;
+    insecticideCol[slot] = plant->insecticideLevel;
+    stateCol[slot] = slotIndexOf(plant->state);
+    speciesCol[slot] = internSpecies(plant->species);
+    createdCol[slot] = plant->createdAt;
+    owners[slot] = plant;
+    fileSlot(slot, stateCol[slot]);
+    scheduler.add(slot);
+
+    plant->store = this;
+    plant->slot = slot;
+    return slot;
+}
+
+/**
+ * @brief Detaches the plant viewing a slot and frees the slot
+ *
+ * The plant gets its last values back so it stays usable after leaving the store.
+ */
+void PlantStore::release(std::uint32_t slot)
+{
+    if (slot >= owners.size() || !owners[slot]) return;
+    wake(slot);
+
+    Plant* plant = owners[slot];
+    plant->moistureLevel = moistureCol[slot];
+    plant->health = healthCol[slot];
+    plant->insecticideLevel = insecticideCol[slot];
+    plant->state = stateAt(stateCol[slot]);
+    plant->createdAt = createdCol[slot];
+    plant->store = nullptr;
+    plant->slot = 0;
+
+    unfileSlot(slot, stateCol[slot]);
+    scheduler.remove(slot);
+    owners[slot] = nullptr;
+    stateCol[slot] = kVacant;
+    freeSlots.push_back(slot);
+}
+
+std::uint32_t PlantStore::size() const
+{
+    return static_cast<std::uint32_t>(owners.size());
+}
+
+std::uint32_t PlantStore::liveCount() const
+{
+    return static_cast<std::uint32_t>(owners.size() - freeSlots.size());
+}
+
+Plant* PlantStore::plantAt(std::uint32_t slot) const
+{
+    return slot < owners.size() ? owners[slot] : nullptr;
+}
+
+void PlantStore::setState(std::uint32_t slot, PlantState* state)
+{
+    if (scheduler.asleep(slot)) wake(slot);
+    const std::uint8_t from = stateCol[slot];
+    stateCol[slot] = slotIndexOf(state);
+    moveBucket(slot, from);
+}
+
+void PlantStore::moveBucket(std::uint32_t slot, std::uint8_t from)
+{
+    const std::uint8_t to = stateCol[slot];
+    if (from == to || !owners[slot]) return;
+    unfileSlot(slot, from);
+    fileSlot(slot, to);
+}
+
+void PlantStore::fileSlot(std::uint32_t slot, std::uint8_t index)
+{
+    if (index >= kStateCount) return;
+    bucketPosition[slot] = static_cast<std::uint32_t>(buckets[index].size());
+    buckets[index].push_back(slot);
+    ++bucketGen[index];
+}
+
+/**
+ * @brief Swap-removes a slot, patching the position of the slot moved into its place
+ */
+void PlantStore::unfileSlot(std::uint32_t slot, std::uint8_t index)
+{
+    if (index >= kStateCount) return;
+    std::vector<std::uint32_t>& bucket = buckets[index];
+    const std::uint32_t pos = bucketPosition[slot];
+    if (pos >= bucket.size() || bucket[pos] != slot) return;
+
+    bucket[pos] = bucket.back();
+    bucketPosition[bucket[pos]] = pos;
+    bucket.pop_back();
+    ++bucketGen[index];
+}
+
+void PlantStore::settle(std::uint32_t slot)
+{
+    if (!scheduler.asleep(slot)) return;
+    TickKernel::advanceIdle(stateCol[slot], moistureCol[slot], healthCol[slot], insecticideCol[slot], scheduler.pendingTicks(slot));
+    scheduler.markSettled(slot);
+}
+
+void PlantStore::wake(std::uint32_t slot)
+{
+    if (!scheduler.asleep(slot)) return;
+    settle(slot);
+    scheduler.wake(slot);
+}
+
+/**
+ * @brief Settles and wakes the slots whose next interesting tick is the coming one
+ */
+void PlantStore::wakeDue()
+{
+    std::vector<std::uint32_t> due;
+    scheduler.collectDue(due);
+    for (std::uint32_t slot : due) wake(slot);
+}
+
+void PlantStore::wakeAll()
+{
+    if (scheduler.sleepingCount() == 0) return;
+    for (std::uint32_t slot = 0; slot < owners.size(); ++slot)
+    {
+        if (owners[slot]) wake(slot);
+    }
+}
+
+PlantFlyweight* PlantStore::speciesAt(std::uint16_t index) const
+{
+    return index < species.size() ? species[index] : nullptr;
+}
+
+std::uint8_t PlantStore::indexOf(const PlantState* state)
+{
+    if (state == &SeedlingState::getInstance()) return 0;
+    if (state == &GrowingState::getInstance()) return 1;
+    if (state == &MatureState::getInstance()) return 2;
+    if (state == &WiltingState::getInstance()) return 3;
+    if (state == &DeadState::getInstance()) return 4;
+    return kStateCount;
+}
+
+/**
+ * @brief Unknown states are treated as Dead so a slot never carries an index the tick cannot map back
+ */
+std::uint8_t PlantStore::slotIndexOf(const PlantState* state)
+{
+    const std::uint8_t index = indexOf(state);
+    return index < kStateCount ? index : indexOf(&DeadState::getInstance());
+}
+
+PlantState* PlantStore::stateAt(std::uint8_t index)
+{
+    switch (index)
+    {
+        case 0: return &SeedlingState::getInstance();
+        case 1: return &GrowingState::getInstance();
+        case 2: return &MatureState::getInstance();
+        case 3: return &WiltingState::getInstance();
+        case 4: return &DeadState::getInstance();
+        default: return nullptr;
+    }
+}
+
+std::uint16_t PlantStore::internSpecies(PlantFlyweight* sp)
+{
+    auto it = speciesIds.find(sp);
+    if (it != speciesIds.end()) return it->second;
+
+    std::uint16_t index = static_cast<std::uint16_t>(species.size());
+    species.push_back(sp);
+    speciesIds.emplace(sp, index);
+    speciesTraits.push_back(sp ? sp->getTraits() : SpeciesTraits{});
+    return index;
+}
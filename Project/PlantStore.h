@@ -0,0 +1,318 @@
+/**
+ * @file PlantStore.h
+ * @brief Defines the PlantStore class, a columnar (structure-of-arrays) store holding the
+ * hot, per-tick attributes of every Plant owned by a Greenhouse.
+ */
+
+#ifndef PLANTSTORE_H
+#define PLANTSTORE_H
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "TickScheduler.h"
+#include "PlantFlyweight.h"
+
+class Plant;
+class PlantState;
+
+/**
+ * @class PlantStore
+ * @brief Keeps moisture, health, insecticide, state, species and creation time of every
+ * attached Plant in contiguous arrays, keyed by a dense integer slot.
+ *
+ * A Plant that is attached to the store becomes a lightweight view: its accessors read and
+ * write the columns at its slot instead of its own members. Plants that are not attached
+ * (prototypes in the PlantRegistry, plants built directly in tests) keep using their own
+ * members, so the Plant API is identical in both cases.
+ *
+ * Slots are stable for the lifetime of a plant. Released slots are recycled through a free
+ * list, so a tick can walk the columns linearly from slot 0 to size().
+ *
+ * Every live slot is also filed in the bucket of its lifecycle state, so the plants in one
+ * state can be listed or counted without visiting the others.
+ *
+ * For the lazy greenhouse tick, a slot can be put to sleep while its plant changes in a straight
+ * line (see TickScheduler). Its columns are then brought up to date on access: reads settle the
+ * slot and let it sleep on, writes and state changes wake it so the next tick runs it normally.
+ */
+class PlantStore
+{
+
+public:
+
+    /// State index stored for a slot that currently holds no plant.
+    static constexpr std::uint8_t kVacant = 0xFF;
+
+    /// Number of lifecycle states that have a state index (Seedling .. Dead).
+    static constexpr std::uint8_t kStateCount = 5;
+
+    /**
+     * @brief Moves the hot attributes of a plant into the store and turns it into a view.
+     * @param plant The plant to attach. Must not already be attached to a store.
+     * @return The slot assigned to the plant.
+     */
+    std::uint32_t attach(Plant* plant);
+
+    /**
+     * @brief Makes room for plants about to be attached, so a batch of attach() calls does not regrow the columns.
+     * @param count Number of plants that will be attached.
+     */
+    void reserve(std::size_t count);
+
+    /**
+     * @brief Copies the slot's attributes back into its plant and frees the slot.
+     * @param slot The slot to release.
+     */
+    void release(std::uint32_t slot);
+
+    /**
+     * @brief Number of slots (live and vacant) that a linear pass has to visit.
+     * @return One past the highest slot ever handed out.
+     */
+    std::uint32_t size() const;
+
+    /**
+     * @brief Number of slots currently holding a plant.
+     * @return The live plant count.
+     */
+    std::uint32_t liveCount() const;
+
+    /**
+     * @brief Returns the plant viewing a slot.
+     * @param slot The slot to look up.
+     * @return The plant, or nullptr if the slot is vacant.
+     */
+    Plant* plantAt(std::uint32_t slot) const;
+
+    /// Returns the moisture column entry for a slot, waking the slot first (for writes).
+    std::int32_t& moisture(std::uint32_t slot) { if (scheduler.asleep(slot)) wake(slot); return moistureCol[slot]; }
+
+    /// Returns the health column entry for a slot, waking the slot first (for writes).
+    std::int32_t& health(std::uint32_t slot) { if (scheduler.asleep(slot)) wake(slot); return healthCol[slot]; }
+
+    /// Returns the insecticide column entry for a slot, waking the slot first (for writes).
+    std::int32_t& insecticide(std::uint32_t slot) { if (scheduler.asleep(slot)) wake(slot); return insecticideCol[slot]; }
+
+    /// Returns the current moisture of a slot; a sleeping slot is settled and sleeps on.
+    std::int32_t moistureAt(std::uint32_t slot) { if (scheduler.asleep(slot)) settle(slot); return moistureCol[slot]; }
+
+    /// Returns the current health of a slot; a sleeping slot is settled and sleeps on.
+    std::int32_t healthAt(std::uint32_t slot) { if (scheduler.asleep(slot)) settle(slot); return healthCol[slot]; }
+
+    /// Returns the current insecticide level of a slot; a sleeping slot is settled and sleeps on.
+    std::int32_t insecticideAt(std::uint32_t slot) { if (scheduler.asleep(slot)) settle(slot); return insecticideCol[slot]; }
+
+    /// Returns the state index of a slot (see indexOf()).
+    std::uint8_t stateIndex(std::uint32_t slot) const { return stateCol[slot]; }
+
+    /// Returns the species index of a slot (see speciesAt()).
+    std::uint16_t speciesIndex(std::uint32_t slot) const { return speciesCol[slot]; }
+
+    /// Returns the creation timestamp of a slot.
+    std::chrono::system_clock::time_point& createdAt(std::uint32_t slot) { return createdCol[slot]; }
+
+    /// Returns the moisture column, indexed by slot (for batch kernels). Sleeping slots are stale.
+    std::int32_t* moistureData() { return moistureCol.data(); }
+
+    /// Returns the health column, indexed by slot (for batch kernels).
+    std::int32_t* healthData() { return healthCol.data(); }
+
+    /// Returns the insecticide column, indexed by slot (for batch kernels).
+    std::int32_t* insecticideData() { return insecticideCol.data(); }
+
+    /// Returns the state index column, indexed by slot (for batch kernels).
+    std::uint8_t* stateData() { return stateCol.data(); }
+
+    /// Returns the species index column, indexed by slot (for batch kernels).
+    const std::uint16_t* speciesData() const { return speciesCol.data(); }
+
+    /// Returns the plant column, indexed by slot; vacant slots hold nullptr.
+    Plant* const* ownerData() const { return owners.data(); }
+
+    /**
+     * @brief Number of species indices handed out so far.
+     * @return One past the highest species index.
+     */
+    std::uint16_t speciesCount() const { return static_cast<std::uint16_t>(species.size()); }
+
+    /**
+     * @brief Stores a new lifecycle state for a slot and moves it to that state's bucket.
+     * @param slot The slot to update.
+     * @param state The new state singleton.
+     */
+    void setState(std::uint32_t slot, PlantState* state);
+
+    /**
+     * @brief Re-files a slot whose state column was written directly (e.g. by TickKernel).
+     * @param slot The slot whose state changed.
+     * @param from The state index the slot had before the write.
+     */
+    void moveBucket(std::uint32_t slot, std::uint8_t from);
+
+    /**
+     * @brief Returns the live slots currently in a lifecycle state, in no particular order.
+     * @param index A state index in the range [0, kStateCount).
+     * @return The bucket of that state.
+     */
+    const std::vector<std::uint32_t>& slotsInState(std::uint8_t index) const { return buckets[index]; }
+
+    /**
+     * @brief Returns a counter that changes whenever a slot enters or leaves a state's bucket.
+     * @param index A state index in the range [0, kStateCount).
+     * @return The bucket's generation; equal values mean the bucket holds the same slots.
+     */
+    std::uint64_t bucketGeneration(std::uint8_t index) const { return bucketGen[index]; }
+
+    /**
+     * @brief Brings a sleeping slot's columns up to the last completed tick; it keeps sleeping.
+     * @param slot The slot.
+     */
+    void settle(std::uint32_t slot);
+
+    /**
+     * @brief Settles a sleeping slot and wakes it.
+     * @param slot The slot.
+     */
+    void wake(std::uint32_t slot);
+
+    /**
+     * @brief Wakes every slot whose sleep ends on the coming tick.
+     */
+    void wakeDue();
+
+    /**
+     * @brief Wakes every sleeping slot, e.g. before a full pass over the columns.
+     */
+    void wakeAll();
+
+    /**
+     * @brief Lets an awake slot skip its next idle ticks.
+     * @param slot The slot, holding its values after the current tick.
+     * @param idle Number of ticks it may skip (see TickKernel::idleTicks()).
+     */
+    void sleep(std::uint32_t slot, std::uint32_t idle) { scheduler.sleep(slot, idle); }
+
+    /**
+     * @brief Marks a tick as completed for the sleep bookkeeping.
+     */
+    void advanceTick() { scheduler.advance(); }
+
+    /**
+     * @brief Lists the slots the lazy tick has to run.
+     * @param out Receives the awake live slots in ascending order.
+     */
+    void collectAwake(std::vector<std::uint32_t>& out) const { scheduler.collectAwake(out); }
+
+    /**
+     * @brief Number of live slots currently asleep.
+     * @return The sleeping slot count.
+     */
+    std::uint32_t sleepingCount() const { return scheduler.sleepingCount(); }
+
+    /**
+     * @brief Returns the species flyweight registered under a species index.
+     * @param index A value previously returned by speciesIndex().
+     * @return The flyweight pointer.
+     */
+    PlantFlyweight* speciesAt(std::uint16_t index) const;
+
+    /**
+     * @brief Returns the traits of the species registered under a species index.
+     * @param index A value previously returned by speciesIndex(), below speciesCount().
+     * @return The traits copied from the flyweight when the species was registered.
+     */
+    const SpeciesTraits& traitsAt(std::uint16_t index) const { return speciesTraits[index]; }
+
+    /**
+     * @brief Maps a state singleton to its compact state index.
+     * @param state One of the PlantState singletons.
+     * @return 0 Seedling, 1 Growing, 2 Mature, 3 Wilting, 4 Dead; kStateCount for nullptr or any
+     * other state.
+     */
+    static std::uint8_t indexOf(const PlantState* state);
+
+    /**
+     * @brief Maps a compact state index back to its singleton.
+     * @param index A state index in the range [0, kStateCount).
+     * @return The state singleton, or nullptr for kVacant.
+     */
+    static PlantState* stateAt(std::uint8_t index);
+
+private:
+
+    /**
+     * @brief Returns the species index for a flyweight, registering it on first use.
+     * @param species The species flyweight.
+     * @return Its dense index.
+     */
+    std::uint16_t internSpecies(PlantFlyweight* species);
+
+    /**
+     * @brief Maps a state to the index stored for a slot.
+     * @param state The plant's state.
+     * @return indexOf(state), with states that have no index stored as Dead.
+     */
+    static std::uint8_t slotIndexOf(const PlantState* state);
+
+    /// Moisture level per slot.
+    std::vector<std::int32_t> moistureCol;
+
+    /// Health per slot.
+    std::vector<std::int32_t> healthCol;
+
+    /// Insecticide level per slot.
+    std::vector<std::int32_t> insecticideCol;
+
+    /// Lifecycle state index per slot (kVacant for free slots).
+    std::vector<std::uint8_t> stateCol;
+
+    /// Species index per slot.
+    std::vector<std::uint16_t> speciesCol;
+
+    /// Creation timestamp per slot.
+    std::vector<std::chrono::system_clock::time_point> createdCol;
+
+    /// Back pointer from each slot to the plant viewing it.
+    std::vector<Plant*> owners;
+
+    /// Live slots of each lifecycle state, indexed by state index.
+    std::vector<std::uint32_t> buckets[kStateCount];
+
+    /// Position of each slot inside its state bucket, indexed by slot.
+    std::vector<std::uint32_t> bucketPosition;
+
+    /// Generation of each state bucket, bumped by fileSlot() and unfileSlot().
+    std::uint64_t bucketGen[kStateCount] = {};
+
+    /**
+     * @brief Appends a slot to a state bucket.
+     * @param slot The slot to file.
+     * @param index Its state index.
+     */
+    void fileSlot(std::uint32_t slot, std::uint8_t index);
+
+    /**
+     * @brief Swap-removes a slot from a state bucket.
+     * @param slot The slot to remove.
+     * @param index The state index whose bucket holds it.
+     */
+    void unfileSlot(std::uint32_t slot, std::uint8_t index);
+
+    /// Awake list and timing wheel of the lazy tick.
+    TickScheduler scheduler;
+
+    /// Slots released and ready for reuse.
+    std::vector<std::uint32_t> freeSlots;
+
+    /// Species flyweights indexed by species index.
+    std::vector<PlantFlyweight*> species;
+
+    /// Reverse lookup from flyweight to species index.
+    std::unordered_map<PlantFlyweight*, std::uint16_t> speciesIds;
+
+    /// Flat traits table indexed by species index, so the tick never calls into a flyweight.
+    std::vector<SpeciesTraits> speciesTraits;
+};
+
+#endif
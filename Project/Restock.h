@@ -9,6 +9,7 @@
 #include "Command.h"
 #include <string>
 #include <vector>
+#include "PlantId.h"
 
 class Greenhouse;
 
@@ -46,7 +47,7 @@ private:
      * Greenhouse during the `execute()` call. This is essential for undo.
      */
 
-	std::vector<std::string> addedPlantIds;
+	std::vector<PlantId> addedPlantIds;
 
 public:
 /**
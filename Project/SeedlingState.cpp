@@ -26,8 +26,9 @@
  * (threshold = 5.0 * growth rate * season factor)
  * (season factor = 0.8 in thriving season, 1.2 otherwise)
  * @param plant Reference to the Plant object whose state is being checked
+ * @param context Frozen time and season of the current tick
  */
-void SeedlingState::checkChange(Plant& plant)
+void SeedlingState::checkChange(Plant& plant, const TickContext& context)
 {
     plant.addWater(-1);
     plant.addInsecticide(-1);
@@ -42,25 +43,38 @@ void SeedlingState::checkChange(Plant& plant)
         if (plant.getInsecticide() < 30) plant.addHealth(-2);
     }
 
-    auto* sp = plant.getSpeciesFly();
-    double growthRate = sp->getGrowthRate();
-    Season current = plant.currentSeason();
-    Season thrive = sp->getThrivingSeason();
-
-    double seasonFactor = (current == thrive) ? 0.8 : 1.2;
-    double adjustedThreshold = 5.0 * growthRate * seasonFactor;
+    double adjustedThreshold = growthThreshold(plant.getSpeciesFly(), context.getSeason());
 
     if (plant.getHealth() <= 0)
     {
         plant.setState(&DeadState::getInstance());
     }
 
-    else if (plant.getAgeDays() > adjustedThreshold && plant.getHealth() > 40)
+    else if (context.ageDays(plant.getCreatedAt()) > adjustedThreshold && plant.getHealth() > 40)
     {
         plant.setState(&GrowingState::getInstance());
     }
 }
 
+/**
+ * @brief Computes the age a seedling must exceed to move on to GrowingState
+ *
+ * Shared with the batch tick in Greenhouse so both paths use the same threshold.
+ */
+double SeedlingState::growthThreshold(PlantFlyweight* species, Season current)
+{
+    return growthThreshold(species->getTraits(), current);
+}
+
+/**
+ * @brief Computes the growth threshold from a species traits record
+ */
+double SeedlingState::growthThreshold(const SpeciesTraits& traits, Season current)
+{
+    double seasonFactor = (current == traits.thrivingSeason) ? 0.8 : 1.2;
+    return 5.0 * traits.growthRate * seasonFactor;
+}
+
 /**
  * @brief Returns the name identifier for this state
  * @return The string "Seedling"
@@ -7,6 +7,7 @@
 #define SEEDLINGSTATE_H
 #include "PlantState.h"
 #include "SingletonState.h"
+#include "PlantFlyweight.h"
 
 /**
  * @class SeedlingState
@@ -23,12 +24,15 @@ public:
 	/**
 	 * @brief Evaluates plant conditions and manages state transitions
 	 * @param plant Reference to the Plant object being evaluated
+	 * @param context Frozen time and season of the current tick
 	 *
 	 * Decrements water and insecticide levels, adjusts health based on care conditions,
 	 * and transitions to GrowingState or DeadState based on age, health, and species
 	 * characteristics.
 	 */
-    void checkChange(Plant& plant) override;
+    void checkChange(Plant& plant, const TickContext& context) override;
+
+    using PlantState::checkChange;
 
 	/**
 	 * @brief Gets the name of this state
@@ -36,6 +40,22 @@ public:
 	 */
     std::string name() override;
 
+	/**
+	 * @brief Age a seedling of a species must exceed before it can start growing
+	 * @param species The plant's species
+	 * @param current The season the check runs in
+	 * @return 5.0 * growth rate * season factor (0.8 in the thriving season, 1.2 otherwise)
+	 */
+    static double growthThreshold(PlantFlyweight* species, Season current);
+
+	/**
+	 * @brief Same threshold, read from a species traits record (used by the batch tick)
+	 * @param traits The species' traits
+	 * @param current The season the check runs in
+	 * @return 5.0 * growth rate * season factor
+	 */
+    static double growthThreshold(const SpeciesTraits& traits, Season current);
+
 private:
 	/**
 	 * @brief Friend declaration to allow SingletonState access to constructor
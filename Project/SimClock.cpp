@@ -0,0 +1,63 @@
+/**
+ * @file SimClock.cpp
+ * @brief Implementation of the SimClock family of simulation clocks
+ */
+
+#include "SimClock.h"
+
+std::atomic<SimClock*> SimClock::installed{nullptr};
+
+SimClock& SimClock::current()
+{
+    static RealTimeClock realTime;
+    SimClock* clock = installed.load(std::memory_order_acquire);
+    return clock ? *clock : realTime;
+}
+
+SimClock* SimClock::install(SimClock* clock)
+{
+    return installed.exchange(clock, std::memory_order_acq_rel);
+}
+
+std::chrono::system_clock::duration SimClock::simDays(double days)
+{
+    return std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::duration<double>(days * kSecondsPerSimDay));
+}
+
+std::chrono::system_clock::time_point RealTimeClock::now() const
+{
+    return std::chrono::system_clock::now();
+}
+
+ScaledClock::ScaledClock(double factor) : origin(std::chrono::system_clock::now()), factor(factor) {}
+
+std::chrono::system_clock::time_point ScaledClock::now() const
+{
+    auto elapsed = std::chrono::system_clock::now() - origin;
+    return origin + std::chrono::duration_cast<std::chrono::system_clock::duration>(elapsed * factor);
+}
+
+double ScaledClock::getFactor() const
+{
+    return factor;
+}
+
+VirtualClock::VirtualClock() : VirtualClock(std::chrono::system_clock::now()) {}
+
+VirtualClock::VirtualClock(std::chrono::system_clock::time_point start) : ticks(start.time_since_epoch().count()) {}
+
+std::chrono::system_clock::time_point VirtualClock::now() const
+{
+    return std::chrono::system_clock::time_point(std::chrono::system_clock::duration(ticks.load(std::memory_order_acquire)));
+}
+
+void VirtualClock::advanceDays(double days)
+{
+    if (days > 0) advance(simDays(days));
+}
+
+void VirtualClock::advance(std::chrono::system_clock::duration step)
+{
+    if (step.count() > 0) ticks.fetch_add(step.count(), std::memory_order_acq_rel);
+}
@@ -0,0 +1,153 @@
+/**
+ * @file SimClock.h
+ * @brief Defines the SimClock interface and its real-time, scaled and virtual implementations,
+ * the single source of "now" for plant ages, seasons and greenhouse ticks.
+ */
+
+#ifndef SIMCLOCK_H
+#define SIMCLOCK_H
+#include <atomic>
+#include <chrono>
+
+/**
+ * @class SimClock
+ * @brief Abstract clock the simulation reads the current instant from.
+ *
+ * Plant creation times, plant ages, the season and every TickContext come from the clock
+ * installed with install(). Without an installed clock the wall clock is used, which keeps the
+ * original behaviour of one simulated day every kSecondsPerSimDay seconds.
+ */
+class SimClock
+{
+
+public:
+
+    /// Wall-clock seconds that make up one simulated day.
+    static constexpr double kSecondsPerSimDay = 10.0;
+
+    virtual ~SimClock() = default;
+
+    /**
+     * @brief Returns the current simulated instant.
+     * @return The time point plants and ticks should treat as "now".
+     */
+    virtual std::chrono::system_clock::time_point now() const = 0;
+
+    /**
+     * @brief Returns the clock the simulation currently uses.
+     * @return The installed clock, or the shared real-time clock if none is installed.
+     */
+    static SimClock& current();
+
+    /**
+     * @brief Makes a clock the simulation-wide source of time.
+     *
+     * The clock is not owned and must outlive its installation. Install clocks between ticks,
+     * not while a Greenhouse is ticking.
+     *
+     * @param clock The clock to use, or nullptr to go back to real time.
+     * @return The previously installed clock (nullptr if real time was in use).
+     */
+    static SimClock* install(SimClock* clock);
+
+    /**
+     * @brief Wall-clock duration of a number of simulated days.
+     * @param days Number of simulated days.
+     * @return The matching system_clock duration.
+     */
+    static std::chrono::system_clock::duration simDays(double days);
+
+private:
+
+    /// Clock returned by current(); nullptr means real time.
+    static std::atomic<SimClock*> installed;
+};
+
+/**
+ * @class RealTimeClock
+ * @brief Clock that follows the system wall clock.
+ */
+class RealTimeClock : public SimClock
+{
+
+public:
+
+    /// Returns std::chrono::system_clock::now().
+    std::chrono::system_clock::time_point now() const override;
+};
+
+/**
+ * @class ScaledClock
+ * @brief Clock that runs a fixed factor faster (or slower) than the wall clock.
+ *
+ * Time starts at the wall-clock instant the clock is created, so plants created before and
+ * after installing it keep sensible ages.
+ */
+class ScaledClock : public SimClock
+{
+
+public:
+
+    /**
+     * @brief Creates a scaled clock starting at the current wall-clock time.
+     * @param factor Simulated seconds per wall-clock second (e.g. 10000 turns a 10 s simulated day into 1 ms).
+     */
+    explicit ScaledClock(double factor);
+
+    /// Returns origin + (wall time since origin) * factor.
+    std::chrono::system_clock::time_point now() const override;
+
+    /// Returns the speed-up factor.
+    double getFactor() const;
+
+private:
+
+    /// Wall-clock instant the clock was created at.
+    std::chrono::system_clock::time_point origin;
+
+    /// Simulated seconds per wall-clock second.
+    double factor;
+};
+
+/**
+ * @class VirtualClock
+ * @brief Clock that only moves when told to, for reproducible runs and skipping ahead.
+ */
+class VirtualClock : public SimClock
+{
+
+public:
+
+    /**
+     * @brief Creates a virtual clock frozen at the current wall-clock time.
+     */
+    VirtualClock();
+
+    /**
+     * @brief Creates a virtual clock frozen at a given instant.
+     * @param start The initial time.
+     */
+    explicit VirtualClock(std::chrono::system_clock::time_point start);
+
+    /// Returns the frozen instant.
+    std::chrono::system_clock::time_point now() const override;
+
+    /**
+     * @brief Moves the clock forward by a number of simulated days.
+     * @param days Days to advance; negative values are ignored.
+     */
+    void advanceDays(double days);
+
+    /**
+     * @brief Moves the clock forward by a wall-clock duration.
+     * @param step Duration to advance; negative values are ignored.
+     */
+    void advance(std::chrono::system_clock::duration step);
+
+private:
+
+    /// Current instant, in system_clock ticks since the epoch.
+    std::atomic<std::chrono::system_clock::rep> ticks;
+};
+
+#endif
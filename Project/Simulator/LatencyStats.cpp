@@ -0,0 +1,84 @@
+/**
+ * @file LatencyStats.cpp
+ * @brief Implementation of the LatencyStats timing collector
+ */
+
+#include "LatencyStats.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+void LatencyStats::record(const std::string& op, std::chrono::steady_clock::duration elapsed)
+{
+    samples[op].push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+/**
+ * @brief Summarises one operation using nearest-rank percentiles
+ */
+LatencyStats::Summary LatencyStats::summarize(const std::string& op) const
+{
+    Summary s;
+    auto it = samples.find(op);
+    if (it == samples.end() || it->second.empty()) return s;
+
+    std::vector<std::int64_t> sorted = it->second;
+    std::sort(sorted.begin(), sorted.end());
+
+    auto rank = [&sorted](double p)
+    {
+        std::size_t idx = static_cast<std::size_t>(std::ceil(p * sorted.size()));
+        return sorted[idx == 0 ? 0 : idx - 1] / 1000.0;
+    };
+
+    double totalNs = 0.0;
+    for (std::int64_t ns : sorted) totalNs += static_cast<double>(ns);
+
+    s.count = sorted.size();
+    s.totalMs = totalNs / 1e6;
+    s.opsPerSec = totalNs > 0.0 ? s.count / (totalNs / 1e9) : 0.0;
+    s.p50Us = rank(0.50);
+    s.p90Us = rank(0.90);
+    s.p99Us = rank(0.99);
+    s.maxUs = sorted.back() / 1000.0;
+    return s;
+}
+
+void LatencyStats::printTable(std::ostream& out) const
+{
+    out << std::left << std::setw(32) << "operation" << std::right
+        << std::setw(10) << "count" << std::setw(14) << "total ms" << std::setw(14) << "ops/s"
+        << std::setw(12) << "p50 us" << std::setw(12) << "p90 us" << std::setw(12) << "p99 us"
+        << std::setw(14) << "max us" << "\n";
+
+    out << std::fixed << std::setprecision(1);
+    for (const auto& entry : samples)
+    {
+        Summary s = summarize(entry.first);
+        out << std::left << std::setw(32) << entry.first << std::right
+            << std::setw(10) << s.count << std::setw(14) << s.totalMs << std::setw(14) << s.opsPerSec
+            << std::setw(12) << s.p50Us << std::setw(12) << s.p90Us << std::setw(12) << s.p99Us
+            << std::setw(14) << s.maxUs << "\n";
+    }
+    out << std::defaultfloat;
+}
+
+void LatencyStats::printJson(std::ostream& out) const
+{
+    out << "{";
+    bool first = true;
+    for (const auto& entry : samples)
+    {
+        Summary s = summarize(entry.first);
+        out << (first ? "" : ",") << "\n    \"" << entry.first << "\": {"
+            << "\"count\": " << s.count
+            << ", \"total_ms\": " << s.totalMs
+            << ", \"ops_per_sec\": " << s.opsPerSec
+            << ", \"p50_us\": " << s.p50Us
+            << ", \"p90_us\": " << s.p90Us
+            << ", \"p99_us\": " << s.p99Us
+            << ", \"max_us\": " << s.maxUs << "}";
+        first = false;
+    }
+    out << "\n  }";
+}
@@ -0,0 +1,101 @@
+/**
+ * @file LatencyStats.h
+ * @brief Defines the LatencyStats class, which collects per-operation timings for the
+ * headless simulator and summarises them as throughput and latency percentiles.
+ */
+
+#ifndef LATENCYSTATS_H
+#define LATENCYSTATS_H
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @class LatencyStats
+ * @brief Keeps every latency sample of every named operation.
+ *
+ * Samples are stored raw (in nanoseconds) so percentiles are exact. Operations are reported
+ * in name order so two runs can be diffed line by line.
+ */
+class LatencyStats
+{
+
+public:
+
+    /**
+     * @struct Summary
+     * @brief Aggregated view of one operation's samples.
+     */
+    struct Summary
+    {
+        /** @brief Number of calls recorded. */
+        std::size_t count = 0;
+        /** @brief Sum of all samples in milliseconds. */
+        double totalMs = 0.0;
+        /** @brief Calls per second of time spent in the operation. */
+        double opsPerSec = 0.0;
+        /** @brief Median latency in microseconds. */
+        double p50Us = 0.0;
+        /** @brief 90th percentile latency in microseconds. */
+        double p90Us = 0.0;
+        /** @brief 99th percentile latency in microseconds. */
+        double p99Us = 0.0;
+        /** @brief Slowest call in microseconds. */
+        double maxUs = 0.0;
+    };
+
+    /**
+     * @brief Records one call of an operation.
+     * @param op Operation name.
+     * @param elapsed Time the call took.
+     */
+    void record(const std::string& op, std::chrono::steady_clock::duration elapsed);
+
+    /**
+     * @brief Times a callable and records it under an operation name.
+     * @param op Operation name.
+     * @param fn Callable to run once.
+     * @return Whatever fn returns.
+     */
+    template <typename Fn>
+    auto time(const std::string& op, Fn&& fn) -> decltype(fn())
+    {
+        struct Recorder
+        {
+            LatencyStats& stats;
+            const std::string& op;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            ~Recorder() { stats.record(op, std::chrono::steady_clock::now() - start); }
+        } recorder{ *this, op };
+        return fn();
+    }
+
+    /**
+     * @brief Summarises one operation.
+     * @param op Operation name.
+     * @return The summary (all zero if the operation was never recorded).
+     */
+    Summary summarize(const std::string& op) const;
+
+    /**
+     * @brief Writes a human-readable table of every operation.
+     * @param out Destination stream.
+     */
+    void printTable(std::ostream& out) const;
+
+    /**
+     * @brief Writes every operation's summary as a JSON object keyed by operation name.
+     * @param out Destination stream.
+     */
+    void printJson(std::ostream& out) const;
+
+private:
+
+    /// Raw samples in nanoseconds, per operation.
+    std::map<std::string, std::vector<std::int64_t>> samples;
+};
+
+#endif
@@ -0,0 +1,257 @@
+/**
+ * @file NurserySimulator.cpp
+ * @brief Implementation of the NurserySimulator headless load driver
+ */
+
+#include "NurserySimulator.h"
+#include "../SpeciesFlyweight.h"
+#include "../SeedlingState.h"
+#include "../GrowingState.h"
+#include "../MatureState.h"
+#include "../TropicalFactory.h"
+#include "../DesertFactory.h"
+#include "../MediterraneanFactory.h"
+#include "../IndoorFactory.h"
+#include "../WetlandFactory.h"
+#include <algorithm>
+#include <chrono>
+#include <tuple>
+
+namespace
+{
+    /// The 25 species seeded by GUI/main.cpp.
+    const std::vector<std::tuple<std::string, std::string, std::string, int, double, double, double, Season>> kSpecies =
+    {
+        {"FERN","Fern","Tropical",6, 1.1,1.2,0.9,Season::Spring},
+        {"MONST","Monstera","Tropical",9, 1.2,1.3,0.8,Season::Summer},
+        {"PALM","Palm","Tropical",11, 1.0,1.1,0.9,Season::Summer},
+        {"BAMBOO","Bamboo","Tropical",8, 1.1,1.0,0.9,Season::Spring},
+        {"ORCHID","Orchid","Tropical",7, 1.3,1.2,0.8,Season::Autumn},
+        {"CACTUS","Cactus","Desert",12, 0.6,1.0,1.1,Season::Summer},
+        {"ALOE","Aloe","Desert",7, 0.7,1.0,1.0,Season::Summer},
+        {"AGAVE","Agave","Desert",10, 0.8,1.1,1.0,Season::Summer},
+        {"SUCCUL","Succulent","Desert",6, 0.7,0.9,1.1,Season::Spring},
+        {"YUCCA","Yucca","Desert",9, 0.6,1.0,1.0,Season::Autumn},
+        {"ROSE","Rose","Mediterranean",10, 1.0,0.9,1.0,Season::Spring},
+        {"LAV","Lavender","Mediterranean",8, 0.9,0.8,1.0,Season::Summer},
+        {"OLIVE","Olive","Mediterranean",15, 0.8,0.8,1.1,Season::Autumn},
+        {"JASMIN","Jasmine","Mediterranean",9, 1.0,0.9,1.0,Season::Spring},
+        {"THYME","Thyme","Mediterranean",7, 0.9,0.8,1.1,Season::Summer},
+        {"POTHOS","Pothos","Indoor",5, 1.0,1.0,1.0,Season::Autumn},
+        {"SNAKE","SnakePlant","Indoor",6, 0.9,1.2,1.2,Season::Winter},
+        {"SPIDER","SpiderPlant","Indoor",5, 1.1,1.0,1.0,Season::Spring},
+        {"PEACE","PeaceLily","Indoor",7, 1.1,1.1,0.9,Season::Summer},
+        {"RUBBER","RubberPlant","Indoor",8, 1.0,1.1,1.0,Season::Autumn},
+        {"LOTUS","Lotus","Wetland",14, 1.3,1.1,0.8,Season::Summer},
+        {"WATERL","WaterLily","Wetland",13, 1.2,1.0,0.8,Season::Summer},
+        {"PAPYR","Papyrus","Wetland",12, 1.4,1.2,0.9,Season::Autumn},
+        {"CATTAIL","Cattail","Wetland",10, 1.3,1.1,0.9,Season::Spring},
+        {"IRIS","Iris","Wetland",11, 1.2,1.0,0.8,Season::Summer}
+    };
+}
+
+NurserySimulator::NurserySimulator(const Config& cfg)
+: config(cfg), greenhouse(&protos), inventory(store, greenhouse), staff(&messenger), customers(&messenger), rng(cfg.seed)
+{
+    previousClock = SimClock::install(&clock);
+
+    greenhouse.addObserver(&inventory);
+    greenhouse.addObserver(&customerDash);
+    greenhouse.addObserver(&staffDash);
+    sales.addObserver(&staffDash);
+    greenhouse.setTickThreads(config.tickThreads);
+    greenhouse.setLazyTick(config.lazyTick);
+
+    facade = std::make_unique<NurseryFacade>(&inventory, &sales, &staff, &customers, &greenhouse, &catalog, &invoker);
+
+    seedCatalog();
+    seedPopulation();
+}
+
+NurserySimulator::~NurserySimulator()
+{
+    SimClock::install(previousClock);
+}
+
+/**
+ * @brief Registers species and prototypes; SKUs beyond the base 25 reuse their traits with a numeric suffix
+ */
+void NurserySimulator::seedCatalog()
+{
+    TropicalFactory tropical;
+    DesertFactory desert;
+    MediterraneanFactory med;
+    IndoorFactory indoor;
+    WetlandFactory wetland;
+
+    for (int i = 0; i < config.species; ++i)
+    {
+        const auto& s = kSpecies[i % kSpecies.size()];
+        int round = i / static_cast<int>(kSpecies.size());
+        std::string sku = std::get<0>(s) + (round ? std::to_string(round + 1) : "");
+
+        auto fw = std::make_shared<SpeciesFlyweight>(sku, std::get<1>(s), std::get<2>(s), std::get<3>(s),
+                                                     std::get<4>(s), std::get<5>(s), std::get<6>(s), std::get<7>(s));
+        catalog.add(fw);
+
+        Plant* proto = nullptr;
+        const std::string& biome = std::get<2>(s);
+        if (biome == "Tropical") proto = tropical.createPlant(sku + "#PROTO", "Green", fw.get());
+        else if (biome == "Desert") proto = desert.createPlant(sku + "#PROTO", "Green", fw.get());
+        else if (biome == "Mediterranean") proto = med.createPlant(sku + "#PROTO", "Green", fw.get());
+        else if (biome == "Indoor") proto = indoor.createPlant(sku + "#PROTO", "Green", fw.get());
+        else if (biome == "Wetland") proto = wetland.createPlant(sku + "#PROTO", "Green", fw.get());
+        if (proto) protos.registerSeedling(sku, std::unique_ptr<Plant>(proto));
+
+        skus.push_back(sku);
+    }
+}
+
+/**
+ * @brief Seeds an even mix of seedling, growing and mature plants; mature ones start in stock
+ */
+void NurserySimulator::seedPopulation()
+{
+    static const std::vector<std::string> colours = {"Green", "Red", "Yellow", "Blue", "Purple"};
+    PlantState* states[] = { &SeedlingState::getInstance(), &GrowingState::getInstance(), &MatureState::getInstance() };
+
+    stats.time("seedPopulation", [&]()
+    {
+        for (const std::string& sku : skus)
+        {
+            for (int i = 0; i < config.plantsPerSku; ++i)
+            {
+                const PlantId id = PlantId::make(sku, static_cast<std::uint32_t>(i + 1));
+                Plant* clone = protos.clone(sku, id, colours[i % colours.size()]);
+                if (!clone) continue;
+
+                PlantState* state = states[i % 3];
+                clone->setState(state);
+                clone->addWater(60);
+                greenhouse.addPlant(std::unique_ptr<Plant>(clone));
+                if (state == &MatureState::getInstance()) inventory.addPlant(id, sku);
+            }
+        }
+    });
+
+    static const StaffRole roles[] = { StaffRole::Sales, StaffRole::PlantCare, StaffRole::Inventory };
+    for (int k = 0; k < config.staff; ++k)
+    {
+        staff.addStaff("STF" + std::to_string(k + 1), "Staff " + std::to_string(k + 1), roles[k % 3]);
+    }
+    for (int m = 0; m < config.customers; ++m)
+    {
+        customerIds.push_back("CUST" + std::to_string(m + 1));
+        customers.addCustomer(customerIds.back(), "Customer " + std::to_string(m + 1));
+    }
+}
+
+void NurserySimulator::run()
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int day = 0; day < config.ticks; ++day)
+    {
+        clock.advanceDays(1);
+        runDay();
+    }
+
+    for (const std::string& id : customerIds)
+    {
+        stats.time("getCustomerReceipts", [&]() { return facade->getCustomerReceipts(id); });
+        stats.time("getPersonalizedRecommendations", [&]() { return facade->getPersonalizedRecommendations(id); });
+    }
+    wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief One simulated day: care routines, shopping, order completion, then the lifecycle tick
+ */
+void NurserySimulator::runDay()
+{
+    std::vector<Plant*> plants = stats.time("listAllPlants", [&]() { return facade->listAllPlants(); });
+
+    // Every staff member looks after an interleaved share of the greenhouse.
+    const int staffCount = std::max(1, config.staff);
+    for (int k = 0; k < config.staff; ++k)
+    {
+        std::vector<Plant*> share;
+        share.reserve(plants.size() / staffCount + 1);
+        for (std::size_t i = k; i < plants.size(); i += staffCount) share.push_back(plants[i]);
+
+        stats.time("runMorningRoutine", [&]() { facade->runMorningRoutine(share); });
+        stats.time("runNightRoutine", [&]() { facade->runNightRoutine(share); });
+    }
+    stats.time("runUrgentCare", [&]() { facade->runUrgentCare(); });
+
+    std::vector<Plant*> available = stats.time("browseAvailable", [&]() { return facade->browseAvailable(); });
+    std::shuffle(available.begin(), available.end(), rng);
+
+    std::uniform_int_distribution<int> cartSize(1, 3);
+    for (const std::string& customerId : customerIds)
+    {
+        std::vector<events::OrderLine> lines;
+        for (int n = cartSize(rng); n > 0 && !available.empty(); --n)
+        {
+            Plant* p = available.back();
+            available.pop_back();
+
+            events::OrderLine line;
+            line.plantId = p->getPlantId();
+            line.speciesSku = p->sku();
+            line.description = p->name();
+            line.finalCost = p->getSpeciesFly()->getCost();
+            lines.push_back(line);
+        }
+        if (lines.empty()) break;
+
+        double total = 0.0;
+        for (const auto& line : lines) total += line.finalCost;
+
+        Receipt receipt = stats.time("checkout", [&]() { return facade->checkout(customerId, lines, total); });
+        if (receipt.success)
+        {
+            ++checkouts;
+            openOrders.push_back(receipt.orderId);
+        }
+    }
+
+    for (const std::string& orderId : openOrders)
+    {
+        auto order = sales.get(orderId);
+        std::size_t lineCount = order ? order->lines.size() : 0;
+        if (stats.time("completeOrder", [&]() { return facade->completeOrder(orderId); })) plantsSold += lineCount;
+    }
+    openOrders.clear();
+
+    stats.time("tickAll", [&]() { facade->tickAllPlants(); });
+}
+
+void NurserySimulator::report(std::ostream& out, bool json) const
+{
+    if (json)
+    {
+        out << "{\n"
+            << "  \"config\": {\"species\": " << config.species << ", \"plants_per_sku\": " << config.plantsPerSku
+            << ", \"customers\": " << config.customers << ", \"staff\": " << config.staff
+            << ", \"ticks\": " << config.ticks << ", \"tick_threads\": " << config.tickThreads << ", \"lazy_tick\": " << (config.lazyTick ? "true" : "false")
+            << ", \"seed\": " << config.seed << "},\n"
+            << "  \"wall_seconds\": " << wallSeconds << ",\n"
+            << "  \"checkouts\": " << checkouts << ",\n"
+            << "  \"plants_sold\": " << plantsSold << ",\n"
+            << "  \"operations\": ";
+        stats.printJson(out);
+        out << "\n}\n";
+        return;
+    }
+
+    out << "Nursery simulation: " << config.species << " SKUs x " << config.plantsPerSku << " plants, "
+        << config.customers << " customers, " << config.staff << " staff, " << config.ticks << " days, "
+        << config.tickThreads << " tick thread(s)" << (config.lazyTick ? ", lazy tick" : "") << "\n"
+        << "Wall time " << wallSeconds << " s, " << checkouts << " checkouts, " << plantsSold << " plants sold\n\n";
+    stats.printTable(out);
+}
+
+const LatencyStats& NurserySimulator::getStats() const
+{
+    return stats;
+}
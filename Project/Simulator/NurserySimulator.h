@@ -0,0 +1,183 @@
+/**
+ * @file NurserySimulator.h
+ * @brief Defines the NurserySimulator class, a headless driver that builds the full nursery
+ * service graph and pushes synthetic customer, staff and lifecycle load through NurseryFacade.
+ */
+
+#ifndef NURSERYSIMULATOR_H
+#define NURSERYSIMULATOR_H
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "LatencyStats.h"
+#include "../SimClock.h"
+#include "../SpeciesCatalog.h"
+#include "../PlantRegistry.h"
+#include "../Greenhouse.h"
+#include "../Inventory.h"
+#include "../InventoryService.h"
+#include "../SalesService.h"
+#include "../StaffService.h"
+#include "../CustomerService.h"
+#include "../ChatMediator.h"
+#include "../ActionLog.h"
+#include "../CustomerDash.h"
+#include "../StaffDash.h"
+#include "../NurseryFacade.h"
+
+/**
+ * @class NurserySimulator
+ * @brief Runs a scripted nursery workload without the Qt front end and times every step.
+ *
+ * The service graph is wired the same way as GUI/main.cpp. Each simulated day staff run
+ * their care routines, customers browse and check out, orders are completed and the
+ * greenhouse ticks once. A VirtualClock advances one simulated day per tick, so plants age
+ * and mature without waiting for the wall clock.
+ */
+class NurserySimulator
+{
+
+public:
+
+    /**
+     * @struct Config
+     * @brief Size and shape of the synthetic workload.
+     */
+    struct Config
+    {
+        /** @brief Number of species (SKUs) in the catalog. */
+        int species = 25;
+        /** @brief Plants created per SKU before the run. */
+        int plantsPerSku = 1000;
+        /** @brief Customers checking out on every simulated day. */
+        int customers = 50;
+        /** @brief Staff members running care routines on every simulated day. */
+        int staff = 5;
+        /** @brief Simulated days (greenhouse ticks). */
+        int ticks = 30;
+        /** @brief Threads used by Greenhouse::tickAll. */
+        unsigned tickThreads = 1;
+        /** @brief Whether Greenhouse::tickAll skips idle plants (see Greenhouse::setLazyTick). */
+        bool lazyTick = false;
+        /** @brief Seed for cart selection. */
+        std::uint32_t seed = 42;
+    };
+
+    /**
+     * @brief Builds the service graph and seeds the greenhouse.
+     * @param config The workload to run.
+     */
+    explicit NurserySimulator(const Config& config);
+
+    /// Restores the clock that was installed before the simulator.
+    ~NurserySimulator();
+
+    NurserySimulator(const NurserySimulator&) = delete;
+    NurserySimulator& operator=(const NurserySimulator&) = delete;
+
+    /**
+     * @brief Runs all configured ticks.
+     */
+    void run();
+
+    /**
+     * @brief Writes the run summary and per-operation latencies.
+     * @param out Destination stream.
+     * @param json true for a JSON document, false for a text table.
+     */
+    void report(std::ostream& out, bool json) const;
+
+    /**
+     * @brief Returns the collected timings.
+     * @return The latency statistics.
+     */
+    const LatencyStats& getStats() const;
+
+private:
+
+    /// Registers the species and their prototypes.
+    void seedCatalog();
+
+    /// Creates the initial plant population, customers and staff.
+    void seedPopulation();
+
+    /// Runs one simulated day.
+    void runDay();
+
+    /// Workload description.
+    Config config;
+
+    /// Clock driving plant age during the run.
+    VirtualClock clock;
+
+    /// Clock installed before the simulator took over.
+    SimClock* previousClock = nullptr;
+
+    /// Species catalog.
+    SpeciesCatalog catalog;
+
+    /// Prototype registry.
+    PlantRegistry protos;
+
+    /// Greenhouse holding every plant.
+    Greenhouse greenhouse;
+
+    /// Inventory records.
+    Inventory store;
+
+    /// Inventory service over the records.
+    InventoryService inventory;
+
+    /// Sales service.
+    SalesService sales;
+
+    /// Chat mediator shared by staff and customers.
+    ChatMediator messenger;
+
+    /// Staff service.
+    StaffService staff;
+
+    /// Customer service.
+    CustomerService customers;
+
+    /// Command log and queue.
+    ActionLog invoker;
+
+    /// Customer dashboard observer.
+    CustomerDash customerDash;
+
+    /// Staff dashboard observer.
+    StaffDash staffDash;
+
+    /// Facade every operation goes through.
+    std::unique_ptr<NurseryFacade> facade;
+
+    /// SKUs registered by seedCatalog().
+    std::vector<std::string> skus;
+
+    /// Customer ids.
+    std::vector<std::string> customerIds;
+
+    /// Orders checked out but not completed yet.
+    std::vector<std::string> openOrders;
+
+    /// Random source for cart selection.
+    std::mt19937 rng;
+
+    /// Timings per operation.
+    LatencyStats stats;
+
+    /// Successful checkouts.
+    std::size_t checkouts = 0;
+
+    /// Plants sold.
+    std::size_t plantsSold = 0;
+
+    /// Wall time of the whole run in seconds.
+    double wallSeconds = 0.0;
+};
+
+#endif
@@ -0,0 +1,95 @@
+/**
+ * @file main.cpp
+ * @brief Command-line entry point of the headless nursery simulator
+ *
+ * Usage: nursery_sim [--species S] [--plants-per-sku N] [--customers M] [--staff K]
+ *                    [--ticks T] [--threads P] [--lazy] [--seed X] [--json] [--verbose]
+ */
+
+#include "NurserySimulator.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    /// Stream buffer that drops everything, used to mute service chatter during a run.
+    class NullBuffer : public std::streambuf
+    {
+    protected:
+        int overflow(int c) override { return traits_type::not_eof(c); }
+    };
+
+    void usage(const char* argv0)
+    {
+        std::cerr << "Usage: " << argv0 << " [--species S] [--plants-per-sku N] [--customers M] [--staff K]\n"
+                  << "       [--ticks T] [--threads P] [--lazy] [--seed X] [--json] [--verbose]\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    NurserySimulator::Config config;
+    bool json = false;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        auto value = [&]() -> long
+        {
+            if (i + 1 >= argc)
+            {
+                usage(argv[0]);
+                std::exit(2);
+            }
+            return std::strtol(argv[++i], nullptr, 10);
+        };
+
+        if (arg == "--species") config.species = static_cast<int>(value());
+        else if (arg == "--plants-per-sku") config.plantsPerSku = static_cast<int>(value());
+        else if (arg == "--customers") config.customers = static_cast<int>(value());
+        else if (arg == "--staff") config.staff = static_cast<int>(value());
+        else if (arg == "--ticks") config.ticks = static_cast<int>(value());
+        else if (arg == "--threads") config.tickThreads = static_cast<unsigned>(value());
+        else if (arg == "--seed") config.seed = static_cast<std::uint32_t>(value());
+        else if (arg == "--lazy") config.lazyTick = true;
+        else if (arg == "--json") json = true;
+        else if (arg == "--verbose") verbose = true;
+        else
+        {
+            usage(argv[0]);
+            return arg == "--help" ? 0 : 2;
+        }
+    }
+
+    if (config.species < 1 || config.plantsPerSku < 0 || config.customers < 0 || config.staff < 0 || config.ticks < 0)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    // The services log to std::cout/std::cerr on every command; keep the report readable.
+    NullBuffer sink;
+    std::streambuf* coutBuf = std::cout.rdbuf();
+    std::streambuf* cerrBuf = std::cerr.rdbuf();
+    if (!verbose)
+    {
+        std::cout.rdbuf(&sink);
+        std::cerr.rdbuf(&sink);
+    }
+
+    std::ostringstream report;
+    {
+        NurserySimulator sim(config);
+        sim.run();
+        sim.report(report, json);
+    }
+
+    std::cout.rdbuf(coutBuf);
+    std::cerr.rdbuf(cerrBuf);
+    std::cout << report.str();
+    return 0;
+}
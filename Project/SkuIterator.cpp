@@ -1,6 +1,11 @@
 #include "SkuIterator.h"
 
-SkuIterator::SkuIterator(const std::vector<Plant*>& plants, const std::string& sku) : plants(plants), targetSku(sku), current(0)
+SkuIterator::SkuIterator(const std::vector<Plant*>& plants, const std::string& sku) : plants(std::make_shared<const std::vector<Plant*>>(plants)), targetSku(sku), prefiltered(false), current(0)
+{
+    first();
+}
+
+SkuIterator::SkuIterator(PlantSnapshot matches) : plants(std::move(matches)), prefiltered(true), current(0)
 {
     first();
 }
@@ -22,17 +27,17 @@ void SkuIterator::next()
     
 bool SkuIterator::isDone() const  
 {
-    return current >= plants.size();
+    return current >= plants->size();
 }
     
 Plant* SkuIterator::currentItem() const  
 {
-    return isDone() ? nullptr : plants[current];
+    return isDone() ? nullptr : (*plants)[current];
 }
 
 void SkuIterator::advanceToMatch() 
 {
-    while (current < plants.size() && (!plants[current] || plants[current]->sku() != targetSku)) 
+    while (current < plants->size() && (!(*plants)[current] || (!prefiltered && (*plants)[current]->sku() != targetSku))) 
     {
         ++current;
     }
@@ -9,6 +9,7 @@
 
 #include "Iterator.h"
 #include "Plant.h"
+#include "PlantSnapshot.h"
 #include <vector>
 #include <string>
 
@@ -32,6 +33,14 @@ public:
 
     SkuIterator(const std::vector<Plant*>& plants, const std::string& sku);
 
+    /**
+     * @brief Constructor for a collection already known to hold only plants of one SKU.
+     * No per-plant SKU comparison is made while iterating.
+     * @param matches Snapshot of the matching Plant pointers, e.g. the Greenhouse's snapshot of its SKU index.
+     */
+
+    explicit SkuIterator(PlantSnapshot matches);
+
     /**
      * @brief Resets the iterator to the beginning of the collection and advances to the first matching plant.
      */
@@ -68,10 +77,10 @@ private:
     void advanceToMatch();
 
     /**
-     * @brief A copy of the collection (or a reference/pointer to it) being iterated and filtered over.
+     * @brief The snapshot being iterated and filtered over, shared with the Greenhouse and other iterators.
      */
 
-    std::vector<Plant*> plants;
+    PlantSnapshot plants;
 
     /**
      * @brief The specific SKU that plants must match to be yielded by the iterator.
@@ -79,6 +88,12 @@ private:
 
     std::string targetSku;
 
+    /**
+     * @brief True when `plants` was pre-filtered and `targetSku` need not be checked.
+     */
+
+    bool prefiltered;
+
     /**
      * @brief The current position (index) within the `plants` vector.
      */
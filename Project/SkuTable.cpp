@@ -0,0 +1,53 @@
+/**
+ * @file SkuTable.cpp
+ * @brief Implementation of the SkuTable SKU intern table
+ */
+
+#include "SkuTable.h"
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    /// Storage behind SkuTable: names by index, and the reverse map.
+    struct Table
+    {
+        std::vector<std::string> names;
+        std::unordered_map<std::string, SpeciesIndex> indices;
+
+        static Table& get()
+        {
+            static Table table;
+            return table;
+        }
+    };
+}
+
+SpeciesIndex SkuTable::intern(const std::string& sku)
+{
+    Table& table = Table::get();
+    auto it = table.indices.find(sku);
+    if (it != table.indices.end()) return it->second;
+
+    SpeciesIndex index = static_cast<SpeciesIndex>(table.names.size());
+    table.names.push_back(sku);
+    table.indices.emplace(sku, index);
+    return index;
+}
+
+SpeciesIndex SkuTable::find(const std::string& sku)
+{
+    const Table& table = Table::get();
+    auto it = table.indices.find(sku);
+    return it == table.indices.end() ? kNoSpecies : it->second;
+}
+
+const std::string& SkuTable::name(SpeciesIndex index)
+{
+    return Table::get().names[index];
+}
+
+std::size_t SkuTable::size()
+{
+    return Table::get().names.size();
+}
@@ -0,0 +1,62 @@
+/**
+ * @file SkuTable.h
+ * @brief Defines SpeciesIndex and the SkuTable class, which interns species SKUs to small integers.
+ */
+
+#ifndef SKUTABLE_H
+#define SKUTABLE_H
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// Small dense integer standing for a species SKU. Per-SKU containers are flat arrays indexed by it.
+using SpeciesIndex = std::uint32_t;
+
+/// SpeciesIndex meaning "no species".
+constexpr SpeciesIndex kNoSpecies = 0xFFFFFFFFu;
+
+/**
+ * @class SkuTable
+ * @brief Process-wide intern table mapping each species SKU to a SpeciesIndex and back.
+ *
+ * Indices are handed out densely from 0 in first-seen order and never reused, so the same SKU has
+ * the same index in every catalog, greenhouse and inventory. SpeciesCatalog::add() interns its SKUs
+ * up front, so the catalog species take the lowest indices.
+ *
+ * Interning is not synchronised: intern from one thread at a time. find() and name() are safe from
+ * any thread as long as nothing is being interned.
+ */
+class SkuTable
+{
+
+public:
+
+    /**
+     * @brief Returns the index of a SKU, assigning the next one if it is new.
+     * @param sku The species SKU.
+     * @return The SKU's index.
+     */
+    static SpeciesIndex intern(const std::string& sku);
+
+    /**
+     * @brief Looks up a SKU without interning it.
+     * @param sku The species SKU.
+     * @return The SKU's index, or kNoSpecies if it was never interned.
+     */
+    static SpeciesIndex find(const std::string& sku);
+
+    /**
+     * @brief Returns the SKU behind an index.
+     * @param index An index returned by intern().
+     * @return The SKU text.
+     */
+    static const std::string& name(SpeciesIndex index);
+
+    /**
+     * @brief Returns how many SKUs have been interned.
+     * @return One past the highest index handed out.
+     */
+    static std::size_t size();
+};
+
+#endif
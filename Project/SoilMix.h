@@ -19,7 +19,8 @@
  * @brief Abstract base class for soil types.
  * 
  * Stores the cost of the soil and defines pure virtual functions for retrieving the soil name
- * and cloning the object (Prototype pattern support).
+ * and cloning the object (Prototype pattern support). Plant kits share one instance per type
+ * among all their plants (Flyweight), so instances are never modified after construction.
  */
 class SoilMix 
 {
@@ -13,7 +13,23 @@
  */
 void SpeciesCatalog::add(std::shared_ptr<PlantFlyweight> fw)
 {
-    if (fw) bySku[fw->getSku()] = std::move(fw);
+    if (!fw) return;
+    SpeciesIndex species = SkuTable::intern(fw->getSku());
+    if (bySku.size() <= species) bySku.resize(species + 1);
+    if (!bySku[species]) ++count;
+    bySku[species] = std::move(fw);
+}
+
+/**
+ * @brief Returns the SpeciesIndex of a species in the catalog
+ *
+ * The index comes from the SkuTable, so it is the same one the Greenhouse
+ * and the Inventory use for that SKU.
+ */
+SpeciesIndex SpeciesCatalog::indexOf(const std::string& sku) const
+{
+    SpeciesIndex species = SkuTable::find(sku);
+    return (species < bySku.size() && bySku[species]) ? species : kNoSpecies;
 }
 
 /**
@@ -24,8 +40,8 @@ void SpeciesCatalog::add(std::shared_ptr<PlantFlyweight> fw)
  */
 std::shared_ptr<PlantFlyweight> SpeciesCatalog::get(std::string sku)
 {
-    auto it = bySku.find(sku);
-    return (it == bySku.end()) ? nullptr : it->second;
+    SpeciesIndex species = indexOf(sku);
+    return (species == kNoSpecies) ? nullptr : bySku[species];
 }
 
 /**
@@ -36,7 +52,7 @@ std::shared_ptr<PlantFlyweight> SpeciesCatalog::get(std::string sku)
  */
 bool SpeciesCatalog::has(std::string sku)
 {
-    return bySku.find(sku) != bySku.end();
+    return indexOf(sku) != kNoSpecies;
 }
 
 /**
@@ -47,7 +63,10 @@ bool SpeciesCatalog::has(std::string sku)
  */
 void SpeciesCatalog::remove(std::string sku)
 {
-	bySku.erase(sku);
+	SpeciesIndex species = indexOf(sku);
+	if (species == kNoSpecies) return;
+	bySku[species].reset();
+	--count;
 }
 
 /**
@@ -59,8 +78,8 @@ void SpeciesCatalog::remove(std::string sku)
 std::vector<std::shared_ptr<PlantFlyweight>> SpeciesCatalog::getAll() const
 {
     std::vector<std::shared_ptr<PlantFlyweight>> out;
-    out.reserve(bySku.size());
-    for (const auto& [_, fw] : bySku)
-        out.push_back(fw);
+    out.reserve(count);
+    for (const auto& fw : bySku)
+        if (fw) out.push_back(fw);
     return out;
 }
\ No newline at end of file
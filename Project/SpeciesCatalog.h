@@ -6,10 +6,10 @@
 #ifndef SPECIESCATALOG_H
 #define SPECIESCATALOG_H
 #include <memory>
-#include <unordered_map>
 #include <string>
 #include <vector>
 #include "PlantFlyweight.h"
+#include "SkuTable.h"
 
 /**
  * @class SpeciesCatalog
@@ -28,11 +28,18 @@ public:
      * @brief Adds a flyweight to the catalog
      * @param fw Shared pointer to the PlantFlyweight object to add
      *
-     * If the flyweight pointer is valid, it will be stored in the catalog
-     * indexed by its SKU identifier.
+     * If the flyweight pointer is valid, its SKU is interned in the SkuTable and the
+     * flyweight is stored in the catalog under the resulting SpeciesIndex.
      */
     void add(std::shared_ptr<PlantFlyweight> fw);
 
+    /**
+     * @brief Returns the SpeciesIndex of a species in the catalog
+     * @param sku The SKU identifier of the plant species
+     * @return The species' index, or kNoSpecies if the catalog does not hold it
+     */
+    SpeciesIndex indexOf(const std::string& sku) const;
+
     /**
      * @brief Retrieves a flyweight from the catalog by SKU
      * @param sku The SKU identifier of the plant species to retrieve
@@ -61,9 +68,14 @@ public:
 
 private:
     /**
-     * @brief Map storing flyweights indexed by their SKU identifiers
+     * @brief Flyweights indexed by the SpeciesIndex of their SKU; null where the catalog has none
+     */
+    std::vector<std::shared_ptr<PlantFlyweight>> bySku;
+
+    /**
+     * @brief Number of non-null entries in bySku
      */
-    std::unordered_map<std::string, std::shared_ptr<PlantFlyweight>> bySku;
+    std::size_t count = 0;
 };
 
 #endif
\ No newline at end of file
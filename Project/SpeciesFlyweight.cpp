@@ -14,14 +14,17 @@
 SpeciesFlyweight::SpeciesFlyweight(std::string sku, std::string name, std::string biome, int basePrice, double waterSensitivity,
 								   double insecticideTolerance, double growthRate, Season thrivingSeason)
 : sku(sku), name(name), biome(biome), basePrice(basePrice), waterSensitivity(waterSensitivity),
-  insecticideTolerance(insecticideTolerance), growthRate(growthRate), thrivingSeason(thrivingSeason) {}
+  insecticideTolerance(insecticideTolerance), growthRate(growthRate), thrivingSeason(thrivingSeason)
+{
+	traits = SpeciesTraits{ waterSensitivity, insecticideTolerance, growthRate, thrivingSeason, basePrice, true };
+}
 
 /**
  * @brief Returns the SKU identifier
  *
  * Provides access to the unique stock keeping unit identifier for this species.
  */
-std::string SpeciesFlyweight::getSku()
+const std::string& SpeciesFlyweight::getSku() const
 {
 	return sku;
 }
@@ -31,7 +34,7 @@ std::string SpeciesFlyweight::getSku()
  *
  * Provides access to the name of this plant species.
  */
-std::string SpeciesFlyweight::getName()
+const std::string& SpeciesFlyweight::getName() const
 {
 	return name;
 }
@@ -41,7 +44,7 @@ std::string SpeciesFlyweight::getName()
  *
  * Provides access to the biome where this species naturally occurs.
  */
-std::string SpeciesFlyweight::getBiome()
+const std::string& SpeciesFlyweight::getBiome() const
 {
 	return biome;
 }
@@ -51,7 +54,7 @@ std::string SpeciesFlyweight::getBiome()
  *
  * Provides access to the base cost of this species.
  */
-int SpeciesFlyweight::getCost()
+int SpeciesFlyweight::getCost() const
 {
 	return basePrice;
 }
@@ -61,7 +64,7 @@ int SpeciesFlyweight::getCost()
  *
  * Provides access to how sensitive this species is to water conditions.
  */
-double SpeciesFlyweight::getWaterSensitivity()
+double SpeciesFlyweight::getWaterSensitivity() const
 {
 	return waterSensitivity;
 }
@@ -71,7 +74,7 @@ double SpeciesFlyweight::getWaterSensitivity()
  *
  * Provides access to this species' tolerance level to insecticides.
  */
-double SpeciesFlyweight::getInsecticideTolerance()
+double SpeciesFlyweight::getInsecticideTolerance() const
 {
 	return insecticideTolerance;
 }
@@ -81,7 +84,7 @@ double SpeciesFlyweight::getInsecticideTolerance()
  *
  * Provides access to the rate at which this species grows.
  */
-double SpeciesFlyweight::getGrowthRate()
+double SpeciesFlyweight::getGrowthRate() const
 {
 	return growthRate;
 }
@@ -91,7 +94,7 @@ double SpeciesFlyweight::getGrowthRate()
  *
  * Provides access to the season in which this species thrives best.
  */
-Season SpeciesFlyweight::getThrivingSeason()
+Season SpeciesFlyweight::getThrivingSeason() const
  {
 	return thrivingSeason;
 }
\ No newline at end of file
@@ -40,49 +40,49 @@ public:
 	 * @brief Gets the SKU identifier
 	 * @return String containing the unique SKU
 	 */
-	std::string getSku() override;
+	const std::string& getSku() const override;
 
 	/**
 	 * @brief Gets the species name
 	 * @return String containing the species name
 	 */
-    std::string getName() override;
+    const std::string& getName() const override;
 
 	/**
 	 * @brief Gets the natural biome
 	 * @return String containing the biome information
 	 */
-    std::string getBiome() override;
+    const std::string& getBiome() const override;
 
 	/**
 	 * @brief Gets the base price
 	 * @return Integer representing the base cost
 	 */
-    int getCost() override;
+    int getCost() const override;
 
 	/**
 	 * @brief Gets the water sensitivity value
 	 * @return Double representing water sensitivity
 	 */
-    double getWaterSensitivity();
+    double getWaterSensitivity() const;
 
 	/**
 	 * @brief Gets the insecticide tolerance level
 	 * @return Double representing insecticide tolerance
 	 */
-    double getInsecticideTolerance();
+    double getInsecticideTolerance() const;
 
 	/**
 	 * @brief Gets the growth rate
 	 * @return Double representing the growth rate
 	 */
-    double getGrowthRate();
+    double getGrowthRate() const;
 
 	/**
 	 * @brief Gets the optimal thriving season
 	 * @return Season enum value
 	 */
-    Season getThrivingSeason();
+    Season getThrivingSeason() const;
 
 private:
 
@@ -16,8 +16,8 @@
  */
 void StaffDash::onEvent(events::Plant e) 
 {
-    if (e.type == events::PlantType::Wilted) alerts.push_back("Plant wilted: " + e.plantId);
-    else if (e.type == events::PlantType::Matured) alerts.push_back("Plant matured: " + e.plantId);
+    if (e.type == events::PlantType::Wilted) alerts.push_back("Plant wilted: " + e.plantId.str());
+    else if (e.type == events::PlantType::Matured) alerts.push_back("Plant matured: " + e.plantId.str());
 }
 
 /**
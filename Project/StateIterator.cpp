@@ -1,6 +1,9 @@
 #include "StateIterator.h"
 
-StateIterator::StateIterator(const std::vector<Plant*>& plants, const PlantState* state): plants(plants), targetState(state), current(0) 
+StateIterator::StateIterator(const std::vector<Plant*>& plants, const PlantState* state)
+: StateIterator(std::make_shared<const std::vector<Plant*>>(plants), state) {}
+
+StateIterator::StateIterator(PlantSnapshot plants, const PlantState* state): plants(std::move(plants)), targetState(state), current(0) 
 {
     first(); 
 }
@@ -23,17 +26,17 @@ void StateIterator::next()
     
 bool StateIterator::isDone() const  
 {
-    return current >= plants.size();
+    return current >= plants->size();
 }
     
 Plant* StateIterator::currentItem() const  
 {
-    return isDone() ? nullptr : plants[current];
+    return isDone() ? nullptr : (*plants)[current];
 }
 
 void StateIterator::advanceToMatch() 
 {
-    while (current < plants.size() && (!plants[current] || plants[current]->getPlantState() != targetState)) 
+    while (current < plants->size() && (!(*plants)[current] || (*plants)[current]->getPlantState() != targetState)) 
     {
          ++current;
     }
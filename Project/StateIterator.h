@@ -10,6 +10,7 @@
 #include "Iterator.h"
 #include "Plant.h"
 #include "PlantState.h"
+#include "PlantSnapshot.h"
 #include <vector>
 
 /**
@@ -33,6 +34,14 @@ public:
 
     StateIterator(const std::vector<Plant*>& plants, const PlantState* state);
 
+    /**
+     * @brief Constructor over a shared snapshot; nothing is copied.
+     * @param plants The snapshot to iterate over, e.g. the Greenhouse's bucket for the state.
+     * @param state A pointer to the target PlantState object to filter the plants by.
+     */
+
+    StateIterator(PlantSnapshot plants, const PlantState* state);
+
     /**
      * @brief Resets the iterator to the beginning of the collection and advances to the first matching plant.
      */
@@ -69,10 +78,10 @@ private:
     void advanceToMatch();
 
     /**
-     * @brief A copy of the collection (or a reference/pointer to it) being iterated and filtered over.
+     * @brief The snapshot being iterated and filtered over, shared with the Greenhouse and other iterators.
      */
 
-    std::vector<Plant*> plants;
+    PlantSnapshot plants;
 
     /**
      * @brief A pointer to the specific PlantState object that plants must match to be yielded by the iterator.
@@ -0,0 +1,60 @@
+/**
+ * @file TickContext.cpp
+ * @brief Implementation of the TickContext per-tick snapshot
+ */
+
+#include "TickContext.h"
+#include "Plant.h"
+#include "PlantStore.h"
+#include "SeedlingState.h"
+#include "GrowingState.h"
+#include <cmath>
+#include <limits>
+
+TickContext::TickContext() : TickContext(SimClock::current().now()) {}
+
+TickContext::TickContext(std::chrono::system_clock::time_point now) : now(now), season(Plant::seasonAt(now)) {}
+
+std::chrono::system_clock::time_point TickContext::getNow() const
+{
+    return now;
+}
+
+Season TickContext::getSeason() const
+{
+    return season;
+}
+
+int TickContext::ageDays(std::chrono::system_clock::time_point createdAt) const
+{
+    return Plant::ageDaysBetween(createdAt, now);
+}
+
+/**
+ * @brief Works out the maturity thresholds once per species instead of once per plant
+ *
+ * Uses the same threshold helpers as SeedlingState and GrowingState, so the limits agree
+ * with checkChange() for the season of this tick. The traits come from the store's flat
+ * table, so no flyweight is called.
+ */
+void TickContext::prepareSpecies(const PlantStore& store)
+{
+    const std::uint16_t count = store.speciesCount();
+    seedlingLimits.assign(count, 0);
+    growingLimits.assign(count, 0);
+    for (std::uint16_t sp = 0; sp < count; ++sp)
+    {
+        const SpeciesTraits& traits = store.traitsAt(sp);
+        seedlingLimits[sp] = ageLimit(SeedlingState::growthThreshold(traits, season));
+        growingLimits[sp] = ageLimit(GrowingState::maturityThreshold(traits, season));
+    }
+}
+
+std::int32_t TickContext::ageLimit(double threshold)
+{
+    if (std::isnan(threshold)) return std::numeric_limits<std::int32_t>::max();
+    const double limit = std::floor(threshold);
+    if (limit >= static_cast<double>(std::numeric_limits<std::int32_t>::max())) return std::numeric_limits<std::int32_t>::max();
+    if (limit <= static_cast<double>(std::numeric_limits<std::int32_t>::min())) return std::numeric_limits<std::int32_t>::min();
+    return static_cast<std::int32_t>(limit);
+}
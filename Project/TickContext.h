@@ -0,0 +1,97 @@
+/**
+ * @file TickContext.h
+ * @brief Defines the TickContext class, the per-tick snapshot of time, season and species
+ * thresholds handed to the plant state machine.
+ */
+
+#ifndef TICKCONTEXT_H
+#define TICKCONTEXT_H
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "PlantFlyweight.h"
+
+class PlantStore;
+
+/**
+ * @class TickContext
+ * @brief Everything a state transition needs that does not belong to a single plant.
+ *
+ * A context freezes "now" and the season when it is created, so every plant checked with it
+ * sees the same instant and the clock and timezone are only consulted once per tick. For a
+ * greenhouse tick it also carries the maturity age limits of every species in the store.
+ */
+class TickContext
+{
+
+public:
+
+    /**
+     * @brief Captures the current time (from SimClock) and season.
+     */
+    TickContext();
+
+    /**
+     * @brief Builds a context for a given instant.
+     * @param now The instant the tick runs at.
+     */
+    explicit TickContext(std::chrono::system_clock::time_point now);
+
+    /**
+     * @brief Returns the frozen instant of this tick.
+     * @return The time point captured at construction.
+     */
+    std::chrono::system_clock::time_point getNow() const;
+
+    /**
+     * @brief Returns the season at the frozen instant.
+     * @return The current Season.
+     */
+    Season getSeason() const;
+
+    /**
+     * @brief Simulated age, at this tick, of a plant created at a given time.
+     * @param createdAt The plant's creation time.
+     * @return Age in simulated days.
+     */
+    int ageDays(std::chrono::system_clock::time_point createdAt) const;
+
+    /**
+     * @brief Computes the Seedling and Growing age limits for every species in a store.
+     * @param store The store whose species indices the limits are keyed by.
+     */
+    void prepareSpecies(const PlantStore& store);
+
+    /// Per species index: age a seedling must exceed to start growing (after prepareSpecies()).
+    const std::int32_t* seedlingAgeLimits() const { return seedlingLimits.data(); }
+
+    /// Per species index: age a growing plant must exceed to mature (after prepareSpecies()).
+    const std::int32_t* growingAgeLimits() const { return growingLimits.data(); }
+
+    /**
+     * @brief Converts a fractional maturity threshold into an integer age limit.
+     *
+     * For an integer age, age > threshold holds exactly when age > floor(threshold), so
+     * integer comparisons against the limit match the double comparison done by the states.
+     *
+     * @param threshold The threshold in simulated days.
+     * @return floor(threshold), saturated to the int32 range (NaN never matures).
+     */
+    static std::int32_t ageLimit(double threshold);
+
+private:
+
+    /// Instant the tick runs at.
+    std::chrono::system_clock::time_point now;
+
+    /// Season at that instant.
+    Season season;
+
+    /// Seedling age limits indexed by species index.
+    std::vector<std::int32_t> seedlingLimits;
+
+    /// Growing age limits indexed by species index.
+    std::vector<std::int32_t> growingLimits;
+};
+
+#endif
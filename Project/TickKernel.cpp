@@ -0,0 +1,442 @@
+/**
+ * @file TickKernel.cpp
+ * @brief Implementation of the TickKernel batch state-transition kernel
+ */
+
+#include "TickKernel.h"
+#include <algorithm>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TICKKERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    /**
+     * @struct Rule
+     * @brief Per-state constants of the checkChange() rules.
+     *
+     * Every state follows the same shape: consume water and insecticide, gain health when both
+     * levels are at least goodMin, otherwise lose health for each level below its limit. The
+     * "else if (low moisture || low insecticide)" guards in the states are implied by the
+     * individual limits, so they need no separate constant.
+     */
+    struct Rule
+    {
+        std::int32_t water;
+        std::int32_t insecticide;
+        std::int32_t goodMin;
+        std::int32_t gain;
+        std::int32_t lowMoisture;
+        std::int32_t moistureLoss;
+        std::int32_t lowInsecticide;
+        std::int32_t insecticideLoss;
+    };
+
+    /// Rules indexed by state index; Dead and the padding entries are all zero (no change).
+    constexpr Rule kRules[8] = {
+        { 1, 1, 40, 2, 30, 3, 30, 2 },  // Seedling
+        { 2, 1, 40, 3, 25, 4, 25, 3 },  // Growing
+        { 5, 5, 55, 4, 30, 5, 30, 4 },  // Mature
+        { 3, 3, 61, 5, 40, 3, 40, 3 },  // Wilting (gains only above 60)
+        { 0, 0, 0, 0, 0, 0, 0, 0 },     // Dead
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+    };
+
+    constexpr std::uint8_t kSeedling = 0;
+    constexpr std::uint8_t kGrowing = 1;
+    constexpr std::uint8_t kMature = 2;
+    constexpr std::uint8_t kWilting = 3;
+    constexpr std::uint8_t kDead = 4;
+}
+
+/**
+ * @brief Applies one tick to a single plant
+ *
+ * Health always stays within [0, 100], so applying the gain or the two losses one at a time
+ * with clamping (as Plant::addHealth does) equals clamping their sum once. A plant is dead
+ * exactly when its health ends at zero, whichever rule brought it there.
+ */
+void TickKernel::runScalar(const Batch& b, std::size_t begin)
+{
+    for (std::size_t i = begin; i < b.count; ++i)
+    {
+        const std::uint8_t st = b.state[i];
+        if (st >= kDead) continue;
+
+        const Rule& r = kRules[st];
+        std::int32_t m = b.moisture[i] - r.water;
+        std::int32_t ins = b.insecticide[i] - r.insecticide;
+        if (m < 0) m = 0;
+        if (ins < 0) ins = 0;
+
+        std::int32_t h = b.health[i];
+        if (m >= r.goodMin && ins >= r.goodMin) h += r.gain;
+        else
+        {
+            if (m < r.lowMoisture) h -= r.moistureLoss;
+            if (ins < r.lowInsecticide) h -= r.insecticideLoss;
+        }
+        if (h < 0) h = 0;
+        if (h > 100) h = 100;
+
+        std::uint8_t next = st;
+        if (st == kWilting && h > 60 && m > 40 && ins > 40) next = kMature;
+        else if (h == 0) next = kDead;
+        else if (st == kSeedling)
+        {
+            if (b.ageDays[i] > b.seedlingAgeLimit[b.species[i]] && h > 40) next = kGrowing;
+        }
+        else if (st == kGrowing)
+        {
+            if (h <= 20) next = kWilting;
+            else if (b.ageDays[i] > b.growingAgeLimit[b.species[i]] && h > 50) next = kMature;
+        }
+        else if (st == kMature && h <= 50) next = kWilting;
+
+        b.moisture[i] = m;
+        b.insecticide[i] = ins;
+        b.health[i] = h;
+        b.state[i] = next;
+    }
+}
+
+namespace
+{
+    /// Health change per tick when the levels after the tick are m and ins.
+    std::int32_t healthStep(const Rule& r, std::int32_t m, std::int32_t ins)
+    {
+        if (m >= r.goodMin && ins >= r.goodMin) return r.gain;
+        return -(m < r.lowMoisture ? r.moistureLoss : 0) - (ins < r.lowInsecticide ? r.insecticideLoss : 0);
+    }
+
+    /**
+     * @brief Ticks a level stays in the band (good, low or below low) it lands in on the next tick
+     *
+     * Below the low limit nothing changes any more, even once the level is clamped at zero.
+     */
+    std::uint32_t ticksInBand(const Rule& r, std::int32_t level, std::int32_t step, std::int32_t lowLimit)
+    {
+        if (level - step >= r.goodMin) return static_cast<std::uint32_t>((level - r.goodMin) / step);
+        if (level - step >= lowLimit) return static_cast<std::uint32_t>((level - lowLimit) / step);
+        return UINT32_MAX;
+    }
+}
+
+/**
+ * @brief Counts ticks with an unchanged health step and no state change
+ *
+ * A Mature plant only leaves its state once health drops to 50 (Wilting) or 0 (Dead), so with
+ * a non-negative step it stays Mature as long as the next tick leaves it above 50, and with a
+ * negative step for as many ticks as health stays at 51 or more.
+ */
+std::uint32_t TickKernel::idleTicks(std::uint8_t st, std::int32_t m, std::int32_t h, std::int32_t ins)
+{
+    if (st != kMature) return 0;
+
+    const Rule& r = kRules[st];
+    const std::int32_t m1 = std::max(m - r.water, 0);
+    const std::int32_t ins1 = std::max(ins - r.insecticide, 0);
+    const std::int32_t step = healthStep(r, m1, ins1);
+
+    std::uint32_t ticks = std::min(ticksInBand(r, m, r.water, r.lowMoisture), ticksInBand(r, ins, r.insecticide, r.lowInsecticide));
+    if (step >= 0)
+    {
+        if (std::min(h + step, 100) <= 50) return 0;
+    }
+    else
+    {
+        if (h <= 50) return 0;
+        ticks = std::min(ticks, static_cast<std::uint32_t>((h - 51) / -step));
+    }
+    return ticks;
+}
+
+void TickKernel::advanceIdle(std::uint8_t st, std::int32_t& m, std::int32_t& h, std::int32_t& ins, std::uint32_t ticks)
+{
+    if (ticks == 0 || st >= kDead) return;
+
+    const Rule& r = kRules[st];
+    const std::int32_t step = healthStep(r, std::max(m - r.water, 0), std::max(ins - r.insecticide, 0));
+    const std::int64_t n = ticks;
+    m = static_cast<std::int32_t>(std::max<std::int64_t>(m - n * r.water, 0));
+    ins = static_cast<std::int32_t>(std::max<std::int64_t>(ins - n * r.insecticide, 0));
+    h = static_cast<std::int32_t>(std::min<std::int64_t>(std::max<std::int64_t>(h + n * step, 0), 100));
+}
+
+#ifdef TICKKERNEL_X86
+
+namespace
+{
+    /// Loads one Rule field of all eight states into the lanes of a 256-bit table.
+    __attribute__((target("avx2")))
+    __m256i ruleTable256(std::int32_t Rule::*field)
+    {
+        return _mm256_setr_epi32(kRules[0].*field, kRules[1].*field, kRules[2].*field, kRules[3].*field,
+                                 kRules[4].*field, kRules[5].*field, kRules[6].*field, kRules[7].*field);
+    }
+
+    /**
+     * @brief AVX2 kernel, eight plants per iteration
+     *
+     * Per-lane constants come from permuting an eight-entry table by the state index. Only the
+     * low three bits take part in the permute, so vacant slots (0xFF) pick the zero entry 7.
+     * Returns the index of the first plant left for the scalar tail.
+     */
+    __attribute__((target("avx2")))
+    std::size_t runAvx2(const TickKernel::Batch& b)
+    {
+        const __m256i tWater = ruleTable256(&Rule::water);
+        const __m256i tIns = ruleTable256(&Rule::insecticide);
+        const __m256i tGood = ruleTable256(&Rule::goodMin);
+        const __m256i tGain = ruleTable256(&Rule::gain);
+        const __m256i tLowM = ruleTable256(&Rule::lowMoisture);
+        const __m256i tLossM = ruleTable256(&Rule::moistureLoss);
+        const __m256i tLowI = ruleTable256(&Rule::lowInsecticide);
+        const __m256i tLossI = ruleTable256(&Rule::insecticideLoss);
+
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i hundred = _mm256_set1_epi32(100);
+        const __m256i c20 = _mm256_set1_epi32(20);
+        const __m256i c40 = _mm256_set1_epi32(40);
+        const __m256i c50 = _mm256_set1_epi32(50);
+        const __m256i c60 = _mm256_set1_epi32(60);
+        const __m256i sSeedling = _mm256_set1_epi32(kSeedling);
+        const __m256i sGrowing = _mm256_set1_epi32(kGrowing);
+        const __m256i sMature = _mm256_set1_epi32(kMature);
+        const __m256i sWilting = _mm256_set1_epi32(kWilting);
+        const __m256i sDead = _mm256_set1_epi32(kDead);
+        const __m256i packBytes = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                   0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+
+        std::size_t i = 0;
+        for (; i + 8 <= b.count; i += 8)
+        {
+            const __m256i st = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(b.state + i)));
+            const __m256i live = _mm256_cmpgt_epi32(sDead, st);
+            if (_mm256_testz_si256(live, live)) continue;
+
+            __m256i m = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b.moisture + i));
+            __m256i ins = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b.insecticide + i));
+            __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b.health + i));
+
+            m = _mm256_max_epi32(_mm256_sub_epi32(m, _mm256_permutevar8x32_epi32(tWater, st)), zero);
+            ins = _mm256_max_epi32(_mm256_sub_epi32(ins, _mm256_permutevar8x32_epi32(tIns, st)), zero);
+
+            const __m256i goodMin = _mm256_sub_epi32(_mm256_permutevar8x32_epi32(tGood, st), one);
+            const __m256i good = _mm256_and_si256(_mm256_cmpgt_epi32(m, goodMin), _mm256_cmpgt_epi32(ins, goodMin));
+            const __m256i lowM = _mm256_cmpgt_epi32(_mm256_permutevar8x32_epi32(tLowM, st), m);
+            const __m256i lowI = _mm256_cmpgt_epi32(_mm256_permutevar8x32_epi32(tLowI, st), ins);
+            const __m256i loss = _mm256_add_epi32(_mm256_and_si256(lowM, _mm256_permutevar8x32_epi32(tLossM, st)),
+                                                  _mm256_and_si256(lowI, _mm256_permutevar8x32_epi32(tLossI, st)));
+            const __m256i gain = _mm256_and_si256(good, _mm256_permutevar8x32_epi32(tGain, st));
+            h = _mm256_add_epi32(h, _mm256_sub_epi32(gain, _mm256_andnot_si256(good, loss)));
+            h = _mm256_min_epi32(_mm256_max_epi32(h, zero), hundred);
+
+            const __m256i species = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b.species + i)));
+            const __m256i isSeedling = _mm256_cmpeq_epi32(st, sSeedling);
+            const __m256i isGrowing = _mm256_cmpeq_epi32(st, sGrowing);
+            const __m256i isMature = _mm256_cmpeq_epi32(st, sMature);
+            const __m256i isWilting = _mm256_cmpeq_epi32(st, sWilting);
+
+            __m256i ageOk = zero;
+            const __m256i young = _mm256_or_si256(isSeedling, isGrowing);
+            if (!_mm256_testz_si256(young, young))
+            {
+                const __m256i limitS = _mm256_mask_i32gather_epi32(zero, b.seedlingAgeLimit, species, isSeedling, 4);
+                const __m256i limitG = _mm256_mask_i32gather_epi32(zero, b.growingAgeLimit, species, isGrowing, 4);
+                const __m256i age = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b.ageDays + i));
+                ageOk = _mm256_and_si256(young, _mm256_cmpgt_epi32(age, _mm256_blendv_epi8(limitG, limitS, isSeedling)));
+            }
+
+            const __m256i dead = _mm256_and_si256(live, _mm256_cmpeq_epi32(h, zero));
+            const __m256i above20 = _mm256_cmpgt_epi32(h, c20);
+            const __m256i above50 = _mm256_cmpgt_epi32(h, c50);
+
+            const __m256i toGrowing = _mm256_and_si256(_mm256_and_si256(isSeedling, ageOk), _mm256_cmpgt_epi32(h, c40));
+            const __m256i toWilting = _mm256_andnot_si256(dead, _mm256_or_si256(_mm256_andnot_si256(above20, isGrowing),
+                                                                                _mm256_andnot_si256(above50, isMature)));
+            const __m256i recovered = _mm256_and_si256(_mm256_and_si256(isWilting, _mm256_cmpgt_epi32(h, c60)),
+                                                       _mm256_and_si256(_mm256_cmpgt_epi32(m, c40), _mm256_cmpgt_epi32(ins, c40)));
+            const __m256i toMature = _mm256_or_si256(_mm256_and_si256(_mm256_and_si256(isGrowing, ageOk), above50), recovered);
+
+            __m256i next = st;
+            next = _mm256_blendv_epi8(next, sGrowing, toGrowing);
+            next = _mm256_blendv_epi8(next, sWilting, toWilting);
+            next = _mm256_blendv_epi8(next, sMature, toMature);
+            next = _mm256_blendv_epi8(next, sDead, dead);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(b.moisture + i), m);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(b.insecticide + i), ins);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(b.health + i), h);
+
+            const __m256i packed = _mm256_shuffle_epi8(next, packBytes);
+            const std::uint32_t lo = static_cast<std::uint32_t>(_mm256_extract_epi32(packed, 0));
+            const std::uint32_t hi = static_cast<std::uint32_t>(_mm256_extract_epi32(packed, 4));
+            const std::uint64_t bytes = lo | (static_cast<std::uint64_t>(hi) << 32);
+            std::memcpy(b.state + i, &bytes, sizeof bytes);
+        }
+        return i;
+    }
+
+    /// Loads one Rule field of the first eight states as bytes, for pshufb lookups.
+    __attribute__((target("sse4.1")))
+    __m128i ruleTable128(std::int32_t Rule::*field)
+    {
+        return _mm_setr_epi8(static_cast<char>(kRules[0].*field), static_cast<char>(kRules[1].*field),
+                             static_cast<char>(kRules[2].*field), static_cast<char>(kRules[3].*field),
+                             static_cast<char>(kRules[4].*field), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    }
+
+    /**
+     * @brief SSE4.1 kernel, four plants per iteration
+     *
+     * Per-lane constants come from a byte shuffle: each 32-bit lane holds its state index in
+     * the low byte and 0x80 in the others, so the lookup yields a zero-extended constant.
+     * Vacant slots (0xFF) have the high bit set and read zero as well.
+     */
+    __attribute__((target("sse4.1")))
+    std::size_t runSse41(const TickKernel::Batch& b)
+    {
+        const __m128i tWater = ruleTable128(&Rule::water);
+        const __m128i tIns = ruleTable128(&Rule::insecticide);
+        const __m128i tGood = ruleTable128(&Rule::goodMin);
+        const __m128i tGain = ruleTable128(&Rule::gain);
+        const __m128i tLowM = ruleTable128(&Rule::lowMoisture);
+        const __m128i tLossM = ruleTable128(&Rule::moistureLoss);
+        const __m128i tLowI = ruleTable128(&Rule::lowInsecticide);
+        const __m128i tLossI = ruleTable128(&Rule::insecticideLoss);
+
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi32(1);
+        const __m128i hundred = _mm_set1_epi32(100);
+        const __m128i c20 = _mm_set1_epi32(20);
+        const __m128i c40 = _mm_set1_epi32(40);
+        const __m128i c50 = _mm_set1_epi32(50);
+        const __m128i c60 = _mm_set1_epi32(60);
+        const __m128i sSeedling = _mm_set1_epi32(kSeedling);
+        const __m128i sGrowing = _mm_set1_epi32(kGrowing);
+        const __m128i sMature = _mm_set1_epi32(kMature);
+        const __m128i sWilting = _mm_set1_epi32(kWilting);
+        const __m128i sDead = _mm_set1_epi32(kDead);
+        const __m128i lookupMask = _mm_set1_epi32(static_cast<int>(0x80808000u));
+        const __m128i packBytes = _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+
+        std::size_t i = 0;
+        for (; i + 4 <= b.count; i += 4)
+        {
+            std::int32_t rawState;
+            std::memcpy(&rawState, b.state + i, sizeof rawState);
+            const __m128i st = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(rawState));
+            const __m128i live = _mm_cmpgt_epi32(sDead, st);
+            if (_mm_testz_si128(live, live)) continue;
+
+            const __m128i key = _mm_or_si128(st, lookupMask);
+            __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b.moisture + i));
+            __m128i ins = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b.insecticide + i));
+            __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b.health + i));
+
+            m = _mm_max_epi32(_mm_sub_epi32(m, _mm_shuffle_epi8(tWater, key)), zero);
+            ins = _mm_max_epi32(_mm_sub_epi32(ins, _mm_shuffle_epi8(tIns, key)), zero);
+
+            const __m128i goodMin = _mm_sub_epi32(_mm_shuffle_epi8(tGood, key), one);
+            const __m128i good = _mm_and_si128(_mm_cmpgt_epi32(m, goodMin), _mm_cmpgt_epi32(ins, goodMin));
+            const __m128i lowM = _mm_cmpgt_epi32(_mm_shuffle_epi8(tLowM, key), m);
+            const __m128i lowI = _mm_cmpgt_epi32(_mm_shuffle_epi8(tLowI, key), ins);
+            const __m128i loss = _mm_add_epi32(_mm_and_si128(lowM, _mm_shuffle_epi8(tLossM, key)),
+                                               _mm_and_si128(lowI, _mm_shuffle_epi8(tLossI, key)));
+            const __m128i gain = _mm_and_si128(good, _mm_shuffle_epi8(tGain, key));
+            h = _mm_add_epi32(h, _mm_sub_epi32(gain, _mm_andnot_si128(good, loss)));
+            h = _mm_min_epi32(_mm_max_epi32(h, zero), hundred);
+
+            const __m128i isSeedling = _mm_cmpeq_epi32(st, sSeedling);
+            const __m128i isGrowing = _mm_cmpeq_epi32(st, sGrowing);
+            const __m128i isMature = _mm_cmpeq_epi32(st, sMature);
+            const __m128i isWilting = _mm_cmpeq_epi32(st, sWilting);
+
+            __m128i ageOk = zero;
+            const __m128i young = _mm_or_si128(isSeedling, isGrowing);
+            if (!_mm_testz_si128(young, young))
+            {
+                std::int32_t limit[4];
+                for (int lane = 0; lane < 4; ++lane)
+                {
+                    const std::uint8_t s = b.state[i + lane];
+                    const std::uint16_t sp = b.species[i + lane];
+                    limit[lane] = s == kSeedling ? b.seedlingAgeLimit[sp] : s == kGrowing ? b.growingAgeLimit[sp] : 0;
+                }
+                const __m128i age = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b.ageDays + i));
+                const __m128i lim = _mm_loadu_si128(reinterpret_cast<const __m128i*>(limit));
+                ageOk = _mm_and_si128(young, _mm_cmpgt_epi32(age, lim));
+            }
+
+            const __m128i dead = _mm_and_si128(live, _mm_cmpeq_epi32(h, zero));
+            const __m128i above20 = _mm_cmpgt_epi32(h, c20);
+            const __m128i above50 = _mm_cmpgt_epi32(h, c50);
+
+            const __m128i toGrowing = _mm_and_si128(_mm_and_si128(isSeedling, ageOk), _mm_cmpgt_epi32(h, c40));
+            const __m128i toWilting = _mm_andnot_si128(dead, _mm_or_si128(_mm_andnot_si128(above20, isGrowing),
+                                                                         _mm_andnot_si128(above50, isMature)));
+            const __m128i recovered = _mm_and_si128(_mm_and_si128(isWilting, _mm_cmpgt_epi32(h, c60)),
+                                                    _mm_and_si128(_mm_cmpgt_epi32(m, c40), _mm_cmpgt_epi32(ins, c40)));
+            const __m128i toMature = _mm_or_si128(_mm_and_si128(_mm_and_si128(isGrowing, ageOk), above50), recovered);
+
+            __m128i next = st;
+            next = _mm_blendv_epi8(next, sGrowing, toGrowing);
+            next = _mm_blendv_epi8(next, sWilting, toWilting);
+            next = _mm_blendv_epi8(next, sMature, toMature);
+            next = _mm_blendv_epi8(next, sDead, dead);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(b.moisture + i), m);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(b.insecticide + i), ins);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(b.health + i), h);
+
+            const std::int32_t bytes = _mm_cvtsi128_si32(_mm_shuffle_epi8(next, packBytes));
+            std::memcpy(b.state + i, &bytes, sizeof bytes);
+        }
+        return i;
+    }
+}
+
+#endif
+
+void TickKernel::run(const Batch& batch)
+{
+    run(batch, best());
+}
+
+void TickKernel::run(const Batch& batch, Isa isa)
+{
+    std::size_t done = 0;
+#ifdef TICKKERNEL_X86
+    if (isa == Isa::Avx2 && supported(Isa::Avx2)) done = runAvx2(batch);
+    else if (isa == Isa::Sse41 && supported(Isa::Sse41)) done = runSse41(batch);
+#else
+    (void)isa;
+#endif
+    runScalar(batch, done);
+}
+
+TickKernel::Isa TickKernel::best()
+{
+    static const Isa detected = supported(Isa::Avx2) ? Isa::Avx2 : supported(Isa::Sse41) ? Isa::Sse41 : Isa::Scalar;
+    return detected;
+}
+
+bool TickKernel::supported(Isa isa)
+{
+    switch (isa)
+    {
+#ifdef TICKKERNEL_X86
+        case Isa::Avx2: return __builtin_cpu_supports("avx2");
+        case Isa::Sse41: return __builtin_cpu_supports("sse4.1");
+#endif
+        case Isa::Scalar: return true;
+        default: return false;
+    }
+}
@@ -0,0 +1,126 @@
+/**
+ * @file TickKernel.h
+ * @brief Defines the TickKernel class, a batch implementation of the Seedling, Growing,
+ * Mature and Wilting state rules that works directly on PlantStore columns.
+ */
+
+#ifndef TICKKERNEL_H
+#define TICKKERNEL_H
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class TickKernel
+ * @brief Applies one tick of the plant state machine to a run of plants at once.
+ *
+ * The kernel reproduces SeedlingState, GrowingState, MatureState and WiltingState
+ * checkChange() exactly (moisture, health, insecticide and resulting state), but reads and
+ * writes plain integer columns instead of calling Plant accessors through virtual dispatch.
+ * Instead of grouping plants by state, every lane looks up the constants of its own state,
+ * so a mixed run of plants is processed 8 (AVX2) or 4 (SSE4.1) at a time. A scalar loop
+ * handles the tail and CPUs without those extensions.
+ *
+ * State indices follow PlantStore::indexOf(): 0 Seedling, 1 Growing, 2 Mature, 3 Wilting,
+ * 4 Dead. Dead plants and any other index (e.g. vacant slots) are left untouched.
+ */
+class TickKernel
+{
+
+public:
+
+    /**
+     * @enum Isa
+     * @brief Instruction set used for a kernel run.
+     */
+    enum class Isa { Scalar, Sse41, Avx2 };
+
+    /**
+     * @struct Batch
+     * @brief Column pointers for a contiguous run of plants. All per-plant arrays hold count entries.
+     */
+    struct Batch
+    {
+        /** @brief Moisture per plant, updated in place. */
+        std::int32_t* moisture = nullptr;
+        /** @brief Health per plant, updated in place. */
+        std::int32_t* health = nullptr;
+        /** @brief Insecticide level per plant, updated in place. */
+        std::int32_t* insecticide = nullptr;
+        /** @brief State index per plant, updated in place. */
+        std::uint8_t* state = nullptr;
+        /** @brief Species index per plant, used to look up the age limits. */
+        const std::uint16_t* species = nullptr;
+        /** @brief Simulated age in days per plant (only read for Seedling and Growing plants). */
+        const std::int32_t* ageDays = nullptr;
+        /** @brief Per species: a Seedling becomes Growing once its age is above this limit (see TickContext). */
+        const std::int32_t* seedlingAgeLimit = nullptr;
+        /** @brief Per species: a Growing plant becomes Mature once its age is above this limit. */
+        const std::int32_t* growingAgeLimit = nullptr;
+        /** @brief Number of plants in the run. */
+        std::size_t count = 0;
+    };
+
+    /**
+     * @brief Runs the kernel with the widest instruction set the CPU supports.
+     * @param batch The columns to update.
+     */
+    static void run(const Batch& batch);
+
+    /**
+     * @brief Runs the kernel with a specific instruction set.
+     * @param batch The columns to update.
+     * @param isa Requested instruction set; falls back to Scalar when unsupported.
+     */
+    static void run(const Batch& batch, Isa isa);
+
+    /**
+     * @brief Returns the widest instruction set usable on this CPU.
+     * @return Avx2, Sse41 or Scalar.
+     */
+    static Isa best();
+
+    /**
+     * @brief Checks whether an instruction set can be used on this CPU and build.
+     * @param isa The instruction set to check.
+     * @return true if run(batch, isa) uses that instruction set.
+     */
+    static bool supported(Isa isa);
+
+    /**
+     * @brief Counts the upcoming ticks over which a plant changes in a straight line.
+     *
+     * Over those ticks moisture and insecticide fall by a fixed step, health moves by a fixed
+     * step (clamped at 100) and the state stays the same, so advanceIdle() can apply any number
+     * of them at once. Only Mature plants are predicted; Seedling and Growing plants depend on
+     * the clock and Wilting plants recover on a combined condition, so they return 0.
+     *
+     * @param state State index of the plant.
+     * @param moisture Current moisture.
+     * @param health Current health.
+     * @param insecticide Current insecticide level.
+     * @return Number of ticks that can be skipped, 0 if the next tick must run normally.
+     */
+    static std::uint32_t idleTicks(std::uint8_t state, std::int32_t moisture, std::int32_t health, std::int32_t insecticide);
+
+    /**
+     * @brief Applies idle ticks in closed form.
+     * @param state State index of the plant.
+     * @param moisture Moisture, updated in place.
+     * @param health Health, updated in place.
+     * @param insecticide Insecticide level, updated in place.
+     * @param ticks Number of ticks; at most idleTicks() of the values passed in.
+     */
+    static void advanceIdle(std::uint8_t state, std::int32_t& moisture, std::int32_t& health, std::int32_t& insecticide,
+                            std::uint32_t ticks);
+
+private:
+
+    /**
+     * @brief Scalar implementation for the plants in [begin, batch.count).
+     * @param batch The columns to update.
+     * @param begin Index of the first plant to process.
+     */
+    static void runScalar(const Batch& batch, std::size_t begin);
+};
+
+#endif
@@ -0,0 +1,90 @@
+/**
+ * @file TickScheduler.cpp
+ * @brief Implementation of the TickScheduler awake list and timing wheel
+ */
+
+#include "TickScheduler.h"
+#include <algorithm>
+
+void TickScheduler::add(std::uint32_t slot)
+{
+    if (wakeTick.size() <= slot)
+    {
+        wakeTick.resize(slot + 1, 0);
+        settledTick.resize(slot + 1, 0);
+        awake.resize(slot / 64 + 1, 0);
+    }
+    wakeTick[slot] = 0;
+    setAwake(slot, true);
+}
+
+void TickScheduler::remove(std::uint32_t slot)
+{
+    if (asleep(slot)) return;
+    setAwake(slot, false);
+}
+
+void TickScheduler::wake(std::uint32_t slot)
+{
+    if (!asleep(slot)) return;
+    wakeTick[slot] = 0;
+    --sleeping;
+    setAwake(slot, true);
+}
+
+/**
+ * @brief Moves a slot from the awake set into the wheel bucket of its wake tick
+ *
+ * The bucket entry is not removed if the slot wakes early; collectDue() drops it later.
+ */
+void TickScheduler::sleep(std::uint32_t slot, std::uint32_t idle)
+{
+    idle = std::min(idle, kHorizon);
+    if (idle == 0 || asleep(slot)) return;
+
+    setAwake(slot, false);
+    const std::uint32_t due = ticks + idle + 1;
+    wakeTick[slot] = due;
+    settledTick[slot] = ticks;
+    wheel[due % kWheelSize].push_back(slot);
+    ++sleeping;
+}
+
+/**
+ * @brief Empties the bucket of the coming tick, keeping the entries that are still current
+ *
+ * Sleeps never exceed kHorizon ticks, so no entry in the bucket belongs to a later turn.
+ */
+void TickScheduler::collectDue(std::vector<std::uint32_t>& out)
+{
+    const std::uint32_t due = ticks + 1;
+    std::vector<std::uint32_t>& bucket = wheel[due % kWheelSize];
+    for (std::uint32_t slot : bucket)
+    {
+        if (wakeTick[slot] == due) out.push_back(slot);
+    }
+    bucket.clear();
+}
+
+/**
+ * @brief Walks the bitmap word by word, so the slots come out sorted without a sort
+ */
+void TickScheduler::collectAwake(std::vector<std::uint32_t>& out) const
+{
+    for (std::size_t w = 0; w < awake.size(); ++w)
+    {
+        std::uint64_t bits = awake[w];
+        while (bits)
+        {
+            out.push_back(static_cast<std::uint32_t>(w * 64 + __builtin_ctzll(bits)));
+            bits &= bits - 1;
+        }
+    }
+}
+
+void TickScheduler::setAwake(std::uint32_t slot, bool on)
+{
+    const std::uint64_t bit = std::uint64_t(1) << (slot % 64);
+    if (on) awake[slot / 64] |= bit;
+    else awake[slot / 64] &= ~bit;
+}
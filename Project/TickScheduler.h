@@ -0,0 +1,137 @@
+/**
+ * @file TickScheduler.h
+ * @brief Defines the TickScheduler class, which tracks which PlantStore slots are ticked every
+ * time and which are asleep in a timing wheel until their next interesting tick.
+ */
+
+#ifndef TICKSCHEDULER_H
+#define TICKSCHEDULER_H
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class TickScheduler
+ * @brief Awake bitmap plus hashed timing wheel over store slots, used by the lazy greenhouse tick.
+ *
+ * A slot is either awake (ticked normally) or asleep until a known tick. While a slot sleeps its
+ * columns are left as they were when it fell asleep; PlantStore settles them in closed form when
+ * they are read (see TickKernel::advanceIdle()). Sleeps are capped at kHorizon ticks, so every
+ * wheel bucket only ever holds slots due in the current turn of the wheel. Entries left behind by
+ * a slot that woke early are recognised by their wake tick and dropped when their bucket comes up.
+ *
+ * Tick numbers count completed ticks: a slot settled at tick t holds the values after tick t.
+ */
+class TickScheduler
+{
+
+public:
+
+    /// Longest sleep, in ticks. One less than the number of wheel buckets.
+    static constexpr std::uint32_t kHorizon = 255;
+
+    /**
+     * @brief Registers a newly attached slot as awake.
+     * @param slot The slot.
+     */
+    void add(std::uint32_t slot);
+
+    /**
+     * @brief Forgets a slot that is being released. The slot must be awake.
+     * @param slot The slot.
+     */
+    void remove(std::uint32_t slot);
+
+    /**
+     * @brief Checks whether a slot is asleep.
+     * @param slot The slot.
+     * @return true if the slot is skipped by the tick until it is due.
+     */
+    bool asleep(std::uint32_t slot) const { return slot < wakeTick.size() && wakeTick[slot] != 0; }
+
+    /**
+     * @brief Number of ticks that have passed since a sleeping slot's columns were last settled.
+     * @param slot A sleeping slot.
+     * @return Ticks to apply in closed form to bring the slot up to date.
+     */
+    std::uint32_t pendingTicks(std::uint32_t slot) const { return ticks - settledTick[slot]; }
+
+    /**
+     * @brief Records that a sleeping slot's columns are now up to date.
+     * @param slot A sleeping slot.
+     */
+    void markSettled(std::uint32_t slot) { settledTick[slot] = ticks; }
+
+    /**
+     * @brief Marks a settled slot awake again.
+     * @param slot A sleeping slot.
+     */
+    void wake(std::uint32_t slot);
+
+    /**
+     * @brief Puts an awake slot to sleep after the current tick.
+     * @param slot The slot; its columns must hold the values after the current tick.
+     * @param idle Ticks it may skip, capped at kHorizon. The slot runs normally on the tick after those.
+     */
+    void sleep(std::uint32_t slot, std::uint32_t idle);
+
+    /**
+     * @brief Collects the sleeping slots due on the coming tick.
+     * @param out Receives the due slots; they are still asleep and must be settled and woken.
+     */
+    void collectDue(std::vector<std::uint32_t>& out);
+
+    /**
+     * @brief Marks the coming tick as completed.
+     */
+    void advance() { ++ticks; }
+
+    /**
+     * @brief Returns the number of completed ticks.
+     * @return The tick counter.
+     */
+    std::uint32_t now() const { return ticks; }
+
+    /**
+     * @brief Lists the awake slots in ascending order.
+     * @param out Receives the awake slots.
+     */
+    void collectAwake(std::vector<std::uint32_t>& out) const;
+
+    /**
+     * @brief Returns how many slots are asleep.
+     * @return The sleeping slot count.
+     */
+    std::uint32_t sleepingCount() const { return sleeping; }
+
+private:
+
+    /// Number of wheel buckets.
+    static constexpr std::uint32_t kWheelSize = kHorizon + 1;
+
+    /**
+     * @brief Sets or clears a slot's awake bit.
+     * @param slot The slot.
+     * @param on true to mark it awake.
+     */
+    void setAwake(std::uint32_t slot, bool on);
+
+    /// Completed ticks.
+    std::uint32_t ticks = 0;
+
+    /// Number of sleeping slots.
+    std::uint32_t sleeping = 0;
+
+    /// One bit per slot, set while the slot is live and ticked normally.
+    std::vector<std::uint64_t> awake;
+
+    /// Tick on which a sleeping slot runs again, indexed by slot; 0 while awake.
+    std::vector<std::uint32_t> wakeTick;
+
+    /// Tick up to which a sleeping slot's columns are current, indexed by slot.
+    std::vector<std::uint32_t> settledTick;
+
+    /// Sleeping slots bucketed by wake tick modulo kWheelSize.
+    std::vector<std::uint32_t> wheel[kWheelSize];
+};
+
+#endif
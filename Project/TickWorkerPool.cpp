@@ -0,0 +1,84 @@
+/**
+ * @file TickWorkerPool.cpp
+ * @brief Implementation of the TickWorkerPool thread pool
+ */
+
+#include "TickWorkerPool.h"
+
+TickWorkerPool::TickWorkerPool(unsigned participants)
+{
+    for (unsigned i = 1; i < participants; ++i)
+    {
+        workers.emplace_back(&TickWorkerPool::workerLoop, this);
+    }
+}
+
+TickWorkerPool::~TickWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& t : workers) t.join();
+}
+
+unsigned TickWorkerPool::participants() const
+{
+    return static_cast<unsigned>(workers.size()) + 1;
+}
+
+/**
+ * @brief Publishes a batch, works on it from the calling thread and waits for the rest
+ */
+void TickWorkerPool::run(unsigned jobs, const std::function<void(unsigned)>& fn)
+{
+    if (jobs == 0) return;
+
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        finished.wait(guard, [this]() { return active == 0; });
+        job = &fn;
+        jobCount = jobs;
+        pending = jobs;
+        nextJob.store(0);
+        ++generation;
+    }
+    wake.notify_all();
+
+    drain();
+
+    std::unique_lock<std::mutex> guard(lock);
+    finished.wait(guard, [this]() { return pending == 0 && active == 0; });
+    job = nullptr;
+}
+
+void TickWorkerPool::drain()
+{
+    for (unsigned i = nextJob.fetch_add(1); i < jobCount; i = nextJob.fetch_add(1))
+    {
+        (*job)(i);
+
+        std::lock_guard<std::mutex> guard(lock);
+        if (--pending == 0) finished.notify_all();
+    }
+}
+
+void TickWorkerPool::workerLoop()
+{
+    std::uint64_t seen = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wake.wait(guard, [&]() { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            ++active;
+        }
+        drain();
+
+        std::lock_guard<std::mutex> guard(lock);
+        if (--active == 0) finished.notify_all();
+    }
+}
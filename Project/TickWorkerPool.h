@@ -0,0 +1,97 @@
+/**
+ * @file TickWorkerPool.h
+ * @brief Defines the TickWorkerPool class, a small fixed-size thread pool used by the
+ * Greenhouse to tick shards of the plant population in parallel.
+ */
+
+#ifndef TICKWORKERPOOL_H
+#define TICKWORKERPOOL_H
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class TickWorkerPool
+ * @brief Runs a batch of numbered jobs across a set of persistent worker threads.
+ *
+ * The calling thread takes part in every batch, so a pool built for N participants owns
+ * N - 1 threads. Jobs are handed out dynamically; run() returns once every job of the batch
+ * has finished.
+ */
+class TickWorkerPool
+{
+
+public:
+
+    /**
+     * @brief Starts the worker threads.
+     * @param participants Total number of threads working on a batch, including the caller.
+     */
+    explicit TickWorkerPool(unsigned participants);
+
+    /// Stops and joins the worker threads.
+    ~TickWorkerPool();
+
+    TickWorkerPool(const TickWorkerPool&) = delete;
+    TickWorkerPool& operator=(const TickWorkerPool&) = delete;
+
+    /**
+     * @brief Returns the number of threads working on a batch, including the caller.
+     * @return The participant count.
+     */
+    unsigned participants() const;
+
+    /**
+     * @brief Runs job(0) .. job(jobs - 1) and waits for all of them to finish.
+     * @param jobs Number of jobs in the batch.
+     * @param job Callable invoked once per job index. Must be safe to call concurrently.
+     */
+    void run(unsigned jobs, const std::function<void(unsigned)>& job);
+
+private:
+
+    /// Main loop of a worker thread.
+    void workerLoop();
+
+    /// Claims and runs jobs of the current batch until none are left.
+    void drain();
+
+    /// Worker threads owned by the pool.
+    std::vector<std::thread> workers;
+
+    /// Guards the batch fields below.
+    std::mutex lock;
+
+    /// Signalled when a new batch starts or the pool stops.
+    std::condition_variable wake;
+
+    /// Signalled when the last job of a batch finishes.
+    std::condition_variable finished;
+
+    /// Job of the current batch.
+    const std::function<void(unsigned)>* job = nullptr;
+
+    /// Number of jobs in the current batch.
+    unsigned jobCount = 0;
+
+    /// Next job index to hand out.
+    std::atomic<unsigned> nextJob{0};
+
+    /// Jobs of the current batch that have not finished yet.
+    unsigned pending = 0;
+
+    /// Workers currently inside drain(); a batch is only published or completed when this is zero.
+    unsigned active = 0;
+
+    /// Incremented for every batch so sleeping workers notice new work.
+    std::uint64_t generation = 0;
+
+    /// Set by the destructor to release the workers.
+    bool stopping = false;
+};
+
+#endif
@@ -1,14 +1,17 @@
 #include "TropicalFactory.h"
 TropicalStrategy TropicalFactory::s;
 
-Pot* TropicalFactory::createPot() 
+GlazedCeramicPot TropicalFactory::sharedPot;
+PeatSoilMix TropicalFactory::sharedSoil;
+
+Pot* TropicalFactory::pot() 
 {
-	return new GlazedCeramicPot();
+	return &sharedPot;
 }
 
-SoilMix* TropicalFactory::createSoilMix() 
+SoilMix* TropicalFactory::soilMix() 
 {
-	return new PeatSoilMix();
+	return &sharedSoil;
 }
 
 CareStrategy* TropicalFactory::careStrategy()
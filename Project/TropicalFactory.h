@@ -29,6 +29,12 @@ class TropicalFactory : public PlantKitFactory
     /// Static instance of the TropicalStrategy (can be used as singleton).
     static TropicalStrategy s;
 
+    /// Pot shared by every tropical plant (Flyweight).
+    static GlazedCeramicPot sharedPot;
+
+    /// Soil mix shared by every tropical plant (Flyweight).
+    static PeatSoilMix sharedSoil;
+
 public:
 
     /**
@@ -40,16 +46,16 @@ public:
 protected:
 
     /**
-     * @brief Creates a tropical-appropriate pot.
-     * @return Pointer to a Pot instance (GlazedCeramicPot).
+     * @brief Returns the shared tropical-appropriate pot.
+     * @return Pointer to the shared Pot (GlazedCeramicPot).
      */
-    Pot* createPot() override;
+    Pot* pot() override;
 
     /**
-     * @brief Creates a tropical-appropriate soil mix.
-     * @return Pointer to a SoilMix instance (PeatSoilMix).
+     * @brief Returns the shared tropical-appropriate soil mix.
+     * @return Pointer to the shared SoilMix (PeatSoilMix).
      */
-    SoilMix* createSoilMix() override;
+    SoilMix* soilMix() override;
 };
 
 #endif
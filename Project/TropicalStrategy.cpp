@@ -31,7 +31,7 @@ void TropicalStrategy::water(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
 
-    int add = static_cast<int>(20 + (species->getWaterSensitivity() * 10));
+    int add = static_cast<int>(20 + (species->getTraits().waterSensitivity * 10));
     const int before = plant.getMoisture();
     const int projected = before + add;
     if (projected > 100)
@@ -56,7 +56,7 @@ void TropicalStrategy::fertilize(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
 
-    int healthBoost = 8 + static_cast<int>(species->getGrowthRate() * 5);
+    int healthBoost = 8 + static_cast<int>(species->getTraits().growthRate * 5);
     if (plant.getHealth() < 60) 
     {
         plant.addHealth(healthBoost);
@@ -78,7 +78,7 @@ void TropicalStrategy::sprayInsecticide(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
     
-    int add = 20 + static_cast<int>(species->getInsecticideTolerance() * 10);
+    int add = 20 + static_cast<int>(species->getTraits().insecticideTolerance * 10);
     const int before = plant.getInsecticide();
     const int projected = before + add;
     if (projected > 100) 
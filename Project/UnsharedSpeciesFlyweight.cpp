@@ -11,16 +11,20 @@
  * Initializes only the core member variables (sku, name, biome, basePrice).
  * Other properties (waterSensitivity, insecticideTolerance, growthRate,
  * thrivingSeason) remain uninitialized and may contain default or garbage values.
+ * The traits record only carries the cost; its care traits stay at zero.
  */
 UnsharedSpeciesFlyweight::UnsharedSpeciesFlyweight(std::string sku, std::string name, std::string biome, int basePrice)
-: sku(sku), name(name), biome(biome), basePrice(basePrice) {}
+: sku(sku), name(name), biome(biome), basePrice(basePrice)
+{
+	traits.cost = basePrice;
+}
 
 /**
  * @brief Returns the SKU identifier
  *
  * Provides access to the unique stock keeping unit identifier for this species.
  */
-std::string UnsharedSpeciesFlyweight::getSku()
+const std::string& UnsharedSpeciesFlyweight::getSku() const
 {
 	return sku;
 }
@@ -30,7 +34,7 @@ std::string UnsharedSpeciesFlyweight::getSku()
  *
  * Provides access to the name of this plant species.
  */
-std::string UnsharedSpeciesFlyweight::getName()
+const std::string& UnsharedSpeciesFlyweight::getName() const
 {
 	return name;
 }
@@ -40,7 +44,7 @@ std::string UnsharedSpeciesFlyweight::getName()
  *
  * Provides access to the biome where this species naturally occurs.
  */
-std::string UnsharedSpeciesFlyweight::getBiome()
+const std::string& UnsharedSpeciesFlyweight::getBiome() const
 {
 	return biome;
 }
@@ -50,7 +54,7 @@ std::string UnsharedSpeciesFlyweight::getBiome()
  *
  * Provides access to the base cost of this species.
  */
-int UnsharedSpeciesFlyweight::getCost()
+int UnsharedSpeciesFlyweight::getCost() const
 {
 	return basePrice;
 }
@@ -61,7 +65,7 @@ int UnsharedSpeciesFlyweight::getCost()
  * Provides access to the water sensitivity value. Note that this value
  * is not initialized in the constructor and may contain default/undefined values.
  */
-double UnsharedSpeciesFlyweight::getWaterSensitivity()
+double UnsharedSpeciesFlyweight::getWaterSensitivity() const
 {
 	return waterSensitivity;
 }
@@ -72,7 +76,7 @@ double UnsharedSpeciesFlyweight::getWaterSensitivity()
  * Provides access to the insecticide tolerance level. Note that this value
  * is not initialized in the constructor and may contain default/undefined values.
  */
-double UnsharedSpeciesFlyweight::getInsecticideTolerance()
+double UnsharedSpeciesFlyweight::getInsecticideTolerance() const
 {
 	return insecticideTolerance;
 }
@@ -83,7 +87,7 @@ double UnsharedSpeciesFlyweight::getInsecticideTolerance()
  * Provides access to the growth rate value. Note that this value
  * is not initialized in the constructor and may contain default/undefined values.
  */
-double UnsharedSpeciesFlyweight::getGrowthRate()
+double UnsharedSpeciesFlyweight::getGrowthRate() const
 {
 	return growthRate;
 }
@@ -94,7 +98,7 @@ double UnsharedSpeciesFlyweight::getGrowthRate()
  * Provides access to the thriving season value. Note that this value
  * is not initialized in the constructor and may contain default/undefined values.
  */
-Season UnsharedSpeciesFlyweight::getThrivingSeason()
+Season UnsharedSpeciesFlyweight::getThrivingSeason() const
 {
 	return thrivingSeason;
 }
\ No newline at end of file
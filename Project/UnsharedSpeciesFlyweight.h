@@ -37,49 +37,49 @@ public:
 	 * @brief Gets the SKU identifier
 	 * @return String containing the unique SKU
 	 */
-    std::string getSku() override;
+    const std::string& getSku() const override;
 
 	/**
 	 * @brief Gets the species name
 	 * @return String containing the species name
 	 */
-    std::string getName() override;
+    const std::string& getName() const override;
 
 	/**
 	 * @brief Gets the natural biome
 	 * @return String containing the biome information
 	 */
-    std::string getBiome() override;
+    const std::string& getBiome() const override;
 
 	/**
 	 * @brief Gets the base price
 	 * @return Integer representing the base cost
 	 */
-    int getCost() override;
+    int getCost() const override;
 
 	/**
 	 * @brief Gets the water sensitivity value
 	 * @return Double representing water sensitivity (may be uninitialized)
 	 */
-    double getWaterSensitivity() override;
+    double getWaterSensitivity() const override;
 
 	/**
 	 * @brief Gets the insecticide tolerance level
 	 * @return Double representing insecticide tolerance (may be uninitialized)
 	 */
-    double getInsecticideTolerance() override;
+    double getInsecticideTolerance() const override;
 
 	/**
 	 * @brief Gets the growth rate
 	 * @return Double representing the growth rate (may be uninitialized)
 	 */
-    double getGrowthRate() override;
+    double getGrowthRate() const override;
 
 	/**
 	 * @brief Gets the thriving season
 	 * @return Season enum value (may be uninitialized)
 	 */
-    Season getThrivingSeason() override;
+    Season getThrivingSeason() const override;
 
 private:
 
@@ -1,14 +1,17 @@
 #include "WetlandFactory.h"
 WetlandStrategy WetlandFactory::s;
 
-Pot* WetlandFactory::createPot() 
+AquaticBasketPot WetlandFactory::sharedPot;
+AquaticSoilMix WetlandFactory::sharedSoil;
+
+Pot* WetlandFactory::pot() 
 {
-	return new AquaticBasketPot();
+	return &sharedPot;
 }
 
-SoilMix* WetlandFactory::createSoilMix() 
+SoilMix* WetlandFactory::soilMix() 
 {
-	return new AquaticSoilMix();
+	return &sharedSoil;
 }
 
 CareStrategy* WetlandFactory::careStrategy()
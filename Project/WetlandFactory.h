@@ -29,6 +29,12 @@ class WetlandFactory : public PlantKitFactory
     /// Static instance of the WetlandStrategy (can be used as singleton).
     static WetlandStrategy s;
 
+    /// Pot shared by every wetland plant (Flyweight).
+    static AquaticBasketPot sharedPot;
+
+    /// Soil mix shared by every wetland plant (Flyweight).
+    static AquaticSoilMix sharedSoil;
+
 public:
 
     /**
@@ -40,16 +46,16 @@ public:
 protected:
 
     /**
-     * @brief Creates a wetland-appropriate pot.
-     * @return Pointer to a Pot instance (AquaticBasketPot).
+     * @brief Returns the shared wetland-appropriate pot.
+     * @return Pointer to the shared Pot (AquaticBasketPot).
      */
-    Pot* createPot() override;
+    Pot* pot() override;
 
     /**
-     * @brief Creates a wetland-appropriate soil mix.
-     * @return Pointer to a SoilMix instance (AquaticSoilMix).
+     * @brief Returns the shared wetland-appropriate soil mix.
+     * @return Pointer to the shared SoilMix (AquaticSoilMix).
      */
-    SoilMix* createSoilMix() override;
+    SoilMix* soilMix() override;
 };
 
 #endif
@@ -30,7 +30,7 @@ void WetlandStrategy::water(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
     
-    int add = static_cast<int>(25 + (species->getWaterSensitivity() * 12));
+    int add = static_cast<int>(25 + (species->getTraits().waterSensitivity * 12));
     const int before = plant.getMoisture();
     const int projected = before + add;
     if (projected > 100) 
@@ -55,7 +55,7 @@ void WetlandStrategy::fertilize(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
     
-    int healthBoost = 10 + static_cast<int>(species->getGrowthRate() * 6);
+    int healthBoost = 10 + static_cast<int>(species->getTraits().growthRate * 6);
     if (plant.getHealth() < 60) 
     {
         plant.addHealth(healthBoost);
@@ -78,7 +78,7 @@ void WetlandStrategy::sprayInsecticide(Plant& plant)
     PlantFlyweight* species = plant.getSpeciesFly();
     if (!species) return;
     
-    int add = 25 + static_cast<int>(species->getInsecticideTolerance() * 10);
+    int add = 25 + static_cast<int>(species->getTraits().insecticideTolerance * 10);
     const int before = plant.getInsecticide();
     const int projected = before + add;
     if (projected > 100) 
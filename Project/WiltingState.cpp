@@ -23,8 +23,9 @@
  * - To MatureState: if health > 60 AND moisture > 40 AND insecticide > 40 (recovery)
  * - To DeadState: if health <= 0
  * @param plant Reference to the Plant object whose state is being checked
+ * @param context Frozen time and season of the current tick
  */
-void WiltingState::checkChange(Plant& plant)
+void WiltingState::checkChange(Plant& plant, const TickContext&)
 {
     plant.addWater(-3);
     plant.addInsecticide(-3);
@@ -22,11 +22,14 @@ public:
     /**
      * @brief Evaluates plant conditions and manages state transitions
      * @param plant Reference to the Plant object being evaluated
+     * @param context Frozen time and season of the current tick
      *
      * Decrements water and insecticide levels (high consumption), adjusts health based on
      * care conditions, and transitions back to MatureState (if recovered) or to DeadState.
      */
-    void checkChange(Plant& plant) override;
+    void checkChange(Plant& plant, const TickContext& context) override;
+
+    using PlantState::checkChange;
 
     /**
      * @brief Gets the name of this state
@@ -0,0 +1,103 @@
+/**
+ * @file BenchWorld.cpp
+ * @brief Implementation of the BenchWorld benchmark fixture
+ */
+
+#include "BenchWorld.h"
+#include "../SpeciesFlyweight.h"
+#include "../MediterraneanFactory.h"
+#include "../SeedlingState.h"
+#include "../GrowingState.h"
+#include "../MatureState.h"
+#include "../WiltingState.h"
+#include <algorithm>
+
+BenchWorld& BenchWorld::get(std::size_t n)
+{
+    static std::unique_ptr<BenchWorld> world;
+    static std::size_t size = 0;
+    if (!world || size != n)
+    {
+        world.reset();
+        world = std::make_unique<BenchWorld>(n);
+        size = n;
+    }
+    return *world;
+}
+
+BenchWorld::BenchWorld(std::size_t n)
+: greenhouse(&protos), inventory(store, greenhouse), staff(&messenger), customers(&messenger)
+{
+    previousClock = SimClock::install(&clock);
+    greenhouse.addObserver(&inventory);
+    facade = std::make_unique<NurseryFacade>(&inventory, &sales, &staff, &customers, &greenhouse, &catalog, &invoker);
+
+    static const Season seasons[] = { Season::Spring, Season::Summer, Season::Autumn, Season::Winter };
+    MediterraneanFactory factory;
+    for (int s = 0; s < kSpeciesCount; ++s)
+    {
+        std::string sku = "SP" + std::to_string(100 + s);
+        auto fw = std::make_shared<SpeciesFlyweight>(sku, "Species " + std::to_string(s), "Mediterranean",
+                                                     5 + s % 10, 1.0, 1.0, 0.8 + 0.02 * s, seasons[s % 4]);
+        catalog.add(fw);
+        Plant* proto = factory.createPlant(sku + "#PROTO", "Green", fw.get());
+        if (proto) protos.registerSeedling(sku, std::unique_ptr<Plant>(proto));
+        skus.push_back(sku);
+    }
+
+    PlantState* states[] = { &SeedlingState::getInstance(), &GrowingState::getInstance(),
+                             &MatureState::getInstance(), &WiltingState::getInstance() };
+    plantIds.reserve(n);
+    plants.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const std::string& sku = skus[i % skus.size()];
+        PlantId id = PlantId::make(sku, static_cast<std::uint32_t>(i / skus.size() + 1));
+        Plant* p = protos.clone(sku, id, "Green");
+        if (!p) continue;
+        p->setState(states[i % 4]);
+        greenhouse.addPlant(std::unique_ptr<Plant>(p));
+        inventory.addPlant(id, sku);
+        plantIds.push_back(id);
+        plants.push_back(p);
+    }
+    topUp();
+
+    for (int k = 0; k < kStaffCount; ++k)
+    {
+        std::string id = "STF" + std::to_string(k + 1);
+        StaffRole role = k % 2 == 0 ? StaffRole::Sales : (k % 4 == 1 ? StaffRole::PlantCare : StaffRole::Inventory);
+        staff.addStaff(id, "Staff " + std::to_string(k + 1), role);
+        if (role == StaffRole::Sales) salesStaffIds.push_back(id);
+    }
+
+    const std::size_t customerCount = std::max<std::size_t>(10, n / 100);
+    for (std::size_t c = 0; c < customerCount; ++c)
+    {
+        customerIds.push_back("CUST" + std::to_string(c + 1));
+        customers.addCustomer(customerIds.back(), "Customer " + std::to_string(c + 1));
+    }
+
+    // Order history: one single-plant order per ten plants, without touching stock.
+    for (std::size_t o = 0; o < n / 10 && !plants.empty(); ++o)
+    {
+        Plant* p = plants[(o * 7) % plants.size()];
+        std::vector<events::OrderLine> lines{ { p->getPlantId(), p->sku(), p->name(), 10.0 } };
+        sales.checkout(customerIds[o % customerIds.size()], lines, 10.0);
+    }
+}
+
+BenchWorld::~BenchWorld()
+{
+    SimClock::install(previousClock);
+}
+
+void BenchWorld::topUp()
+{
+    for (Plant* p : plants)
+    {
+        p->addWater(100);
+        p->addInsecticide(100);
+        p->addHealth(100);
+    }
+}
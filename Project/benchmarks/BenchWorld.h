@@ -0,0 +1,130 @@
+/**
+ * @file BenchWorld.h
+ * @brief Defines the BenchWorld class, a fully wired nursery of a given size shared by the
+ * microbenchmarks.
+ */
+
+#ifndef BENCHWORLD_H
+#define BENCHWORLD_H
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../SimClock.h"
+#include "../SpeciesCatalog.h"
+#include "../PlantRegistry.h"
+#include "../Greenhouse.h"
+#include "../Inventory.h"
+#include "../InventoryService.h"
+#include "../SalesService.h"
+#include "../StaffService.h"
+#include "../CustomerService.h"
+#include "../ChatMediator.h"
+#include "../ActionLog.h"
+#include "../NurseryFacade.h"
+
+/**
+ * @class BenchWorld
+ * @brief A nursery holding a fixed number of plants, with inventory, orders and people.
+ *
+ * Layout for a population of n plants:
+ * - kSpeciesCount SKUs, plants assigned round-robin, states cycling Seedling/Growing/Mature/Wilting
+ * - every plant registered as available stock
+ * - max(10, n / 100) customers and kStaffCount staff (half of them Sales)
+ * - n / 10 completed checkouts spread over the customers
+ *
+ * Building a large world is slow, so get() keeps the most recent one alive and only rebuilds
+ * when a benchmark asks for a different size. Time is a frozen VirtualClock, so ticks are
+ * reproducible.
+ */
+class BenchWorld
+{
+
+public:
+
+    /// Number of species in the catalog.
+    static constexpr int kSpeciesCount = 25;
+
+    /// Number of staff members.
+    static constexpr int kStaffCount = 16;
+
+    /**
+     * @brief Returns a world with n plants, building it if needed.
+     * @param n Plant population.
+     * @return The shared world.
+     */
+    static BenchWorld& get(std::size_t n);
+
+    /**
+     * @brief Builds a world with n plants.
+     * @param n Plant population.
+     */
+    explicit BenchWorld(std::size_t n);
+
+    /// Restores the previously installed clock.
+    ~BenchWorld();
+
+    BenchWorld(const BenchWorld&) = delete;
+    BenchWorld& operator=(const BenchWorld&) = delete;
+
+    /**
+     * @brief Refills water, insecticide and health of every plant so ticks never kill one.
+     */
+    void topUp();
+
+    /// Frozen clock used while the world exists.
+    VirtualClock clock;
+
+    /// Clock installed before this world.
+    SimClock* previousClock = nullptr;
+
+    /// Species catalog.
+    SpeciesCatalog catalog;
+
+    /// Prototype registry.
+    PlantRegistry protos;
+
+    /// Greenhouse with every plant.
+    Greenhouse greenhouse;
+
+    /// Inventory records.
+    Inventory store;
+
+    /// Inventory service.
+    InventoryService inventory;
+
+    /// Sales service.
+    SalesService sales;
+
+    /// Chat mediator.
+    ChatMediator messenger;
+
+    /// Staff service.
+    StaffService staff;
+
+    /// Customer service.
+    CustomerService customers;
+
+    /// Command log.
+    ActionLog invoker;
+
+    /// Facade over the services.
+    std::unique_ptr<NurseryFacade> facade;
+
+    /// SKUs in catalog order.
+    std::vector<std::string> skus;
+
+    /// Plant ids in creation order.
+    std::vector<PlantId> plantIds;
+
+    /// Plants in creation order.
+    std::vector<Plant*> plants;
+
+    /// Customer ids.
+    std::vector<std::string> customerIds;
+
+    /// Ids of the Sales staff.
+    std::vector<std::string> salesStaffIds;
+};
+
+#endif
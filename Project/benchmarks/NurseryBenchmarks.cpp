@@ -0,0 +1,418 @@
+/**
+ * @file NurseryBenchmarks.cpp
+ * @brief Google Benchmark microbenchmarks for the core nursery services
+ *
+ * Every benchmark runs at 1k, 10k, 100k and 1M plants. Set NURSERY_BENCH_MAX_PLANTS to
+ * drop the larger sizes on small machines. Benchmarks are registered size by size so the
+ * shared BenchWorld is built once per size.
+ *
+ * Usage: nursery_bench [google benchmark flags]
+ * e.g.   nursery_bench --benchmark_out=bench_results.json --benchmark_out_format=json
+ */
+
+#include "BenchWorld.h"
+#include "../StateIterator.h"
+#include "../SkuIterator.h"
+#include "../MatureState.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+/// Heap allocations made by the process, counted so benchmarks can report allocations per item.
+static std::atomic<std::size_t> gAllocations{ 0 };
+
+void* operator new(std::size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace
+{
+    /// Stream buffer that drops everything, used to mute service chatter during a run.
+    class NullBuffer : public std::streambuf
+    {
+    protected:
+        int overflow(int c) override { return traits_type::not_eof(c); }
+    };
+
+    /// Records the population size so results can be grouped by it.
+    void setPlants(benchmark::State& state, const BenchWorld& world)
+    {
+        state.counters["plants"] = static_cast<double>(world.plants.size());
+    }
+
+    void BM_TickAll(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        for (auto _ : state)
+        {
+            world.greenhouse.tickAll();
+            state.PauseTiming();
+            world.topUp();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * world.plants.size());
+        setPlants(state, world);
+    }
+
+    void BM_TickAllLazy(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        world.greenhouse.setLazyTick(true);
+        std::size_t ticks = 0;
+        double sleeping = 0;
+        for (auto _ : state)
+        {
+            world.greenhouse.tickAll();
+            sleeping += world.greenhouse.getSleepingCount();
+
+            // Caring wakes every plant, so only top up once a week.
+            if (++ticks % 7 == 0)
+            {
+                state.PauseTiming();
+                world.topUp();
+                state.ResumeTiming();
+            }
+        }
+        state.counters["sleeping"] = benchmark::Counter(sleeping, benchmark::Counter::kAvgIterations);
+        world.greenhouse.setLazyTick(false);
+        world.topUp();
+        state.SetItemsProcessed(state.iterations() * world.plants.size());
+        setPlants(state, world);
+    }
+
+    /// Reads every column the staff window shows for a plant, the way refreshGreenhouse() does.
+    std::size_t readRow(Plant* p)
+    {
+        std::size_t bytes = p->id().size();
+        bytes += p->getSpeciesFly()->getName().size();
+        bytes += p->getColour().size();
+        bytes += p->getPlantState()->name().size();
+        bytes += p->getSpeciesFly()->getBiome().size();
+        bytes += p->sku().size();
+        return bytes + p->getAgeDays() + p->getMoisture() + p->getInsecticide() + p->getHealth();
+    }
+
+    /// Same row read through by-value copies, as the accessors returned before they handed out references.
+    std::size_t readRowByValue(Plant* p)
+    {
+        std::string id = p->id();
+        std::string species = p->getSpeciesFly()->getName();
+        std::string colour = p->getColour();
+        std::string stateName = p->getPlantState()->name();
+        std::string biome = p->getSpeciesFly()->getBiome();
+        std::string sku = p->sku();
+        return id.size() + species.size() + colour.size() + stateName.size() + biome.size() + sku.size()
+             + p->getAgeDays() + p->getMoisture() + p->getInsecticide() + p->getHealth();
+    }
+
+    template <std::size_t (*Read)(Plant*)>
+    void BM_RefreshRows(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        std::size_t allocations = 0;
+        for (auto _ : state)
+        {
+            std::size_t before = gAllocations.load(std::memory_order_relaxed);
+            std::vector<Plant*> rows = world.facade->listAllPlants();
+            std::size_t bytes = 0;
+            for (Plant* p : rows) bytes += Read(p);
+            benchmark::DoNotOptimize(bytes);
+            allocations += gAllocations.load(std::memory_order_relaxed) - before;
+        }
+        state.counters["allocs_per_plant"] = static_cast<double>(allocations) / (state.iterations() * world.plants.size());
+        state.SetItemsProcessed(state.iterations() * world.plants.size());
+        setPlants(state, world);
+    }
+
+    /// Ships n plants into an empty greenhouse, then removes them again outside the timed region.
+    void BM_ReceiveShipment(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        Greenhouse greenhouse(&world.protos);
+        const std::string& sku = world.skus.front();
+        const int batch = static_cast<int>(world.plants.size());
+        std::uint32_t shipped = 0;
+        std::size_t allocations = 0;
+        for (auto _ : state)
+        {
+            std::size_t before = gAllocations.load(std::memory_order_relaxed);
+            greenhouse.receiveShipment(sku, batch);
+            allocations += gAllocations.load(std::memory_order_relaxed) - before;
+
+            state.PauseTiming();
+            for (int i = 0; i < batch; ++i) greenhouse.removePlant(PlantId::make(sku, ++shipped));
+            state.ResumeTiming();
+        }
+        state.counters["allocs_per_plant"] = static_cast<double>(allocations) / (state.iterations() * batch);
+        state.counters["slabs"] = static_cast<double>(greenhouse.getArena().slabCount());
+        state.SetItemsProcessed(state.iterations() * batch);
+        setPlants(state, world);
+    }
+
+    void BM_CountBySku(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        std::size_t k = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(world.greenhouse.countBySku(world.skus[k++ % world.skus.size()]));
+        }
+        state.SetItemsProcessed(state.iterations());
+        setPlants(state, world);
+    }
+
+    void BM_SkuIterator(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        std::size_t k = 0;
+        std::size_t visited = 0;
+        for (auto _ : state)
+        {
+            std::unique_ptr<Iterator> it = world.greenhouse.createSkuIterator(world.skus[k++ % world.skus.size()]);
+            for (it->first(); !it->isDone(); it->next())
+            {
+                benchmark::DoNotOptimize(it->currentItem());
+                ++visited;
+            }
+        }
+        state.SetItemsProcessed(visited);
+        setPlants(state, world);
+    }
+
+    void BM_StateIterator(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        std::size_t visited = 0;
+        for (auto _ : state)
+        {
+            std::unique_ptr<Iterator> it = world.greenhouse.createStateIterator(&MatureState::getInstance());
+            for (it->first(); !it->isDone(); it->next())
+            {
+                benchmark::DoNotOptimize(it->currentItem());
+                ++visited;
+            }
+        }
+        state.SetItemsProcessed(visited);
+        setPlants(state, world);
+    }
+
+    void BM_PlantsInState(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        std::size_t visited = 0;
+        for (auto _ : state)
+        {
+            for (Plant* p : world.greenhouse.plantsInState(&MatureState::getInstance()))
+            {
+                benchmark::DoNotOptimize(p);
+                ++visited;
+            }
+        }
+        state.SetItemsProcessed(visited);
+        setPlants(state, world);
+    }
+
+    void BM_ReservePlant(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        std::size_t k = 0;
+        for (auto _ : state)
+        {
+            PlantId id = world.plantIds[k++ % world.plantIds.size()];
+            benchmark::DoNotOptimize(world.inventory.reservePlant(id));
+            state.PauseTiming();
+            world.inventory.releasePlantFromOrder(id);
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations());
+        setPlants(state, world);
+    }
+
+    void BM_MarkSold(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        std::size_t k = 0;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            std::size_t i = k++ % world.plantIds.size();
+            PlantId id = world.plantIds[i];
+            world.inventory.reservePlant(id);
+            state.ResumeTiming();
+
+            benchmark::DoNotOptimize(world.inventory.markSold(id));
+
+            // A Matured event puts the plant back on the shelf for the next round.
+            state.PauseTiming();
+            world.inventory.onEvent(events::Plant{ id, world.skus[i % world.skus.size()], events::PlantType::Matured });
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations());
+        setPlants(state, world);
+    }
+
+    void BM_ListAvailablePlants(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(world.inventory.listAvailablePlants());
+        }
+        state.SetItemsProcessed(state.iterations() * world.plants.size());
+        setPlants(state, world);
+    }
+
+    /// Reserves and releases one plant, then asks for the available list: the patch path of the view.
+    void BM_AvailableSnapshot(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        const std::vector<PlantId> available = world.inventory.listAvailablePlants();
+        if (available.empty())
+        {
+            state.SkipWithError("no available plants");
+            return;
+        }
+        std::size_t k = 0;
+        for (auto _ : state)
+        {
+            const PlantId id = available[k++ % available.size()];
+            world.inventory.reservePlant(id);
+            world.inventory.releasePlantFromOrder(id);
+            benchmark::DoNotOptimize(world.facade->availableSnapshot()->size());
+        }
+        state.SetItemsProcessed(state.iterations());
+        setPlants(state, world);
+    }
+
+    void BM_Checkout(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        std::size_t k = 0;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            std::size_t i = k++;
+            std::vector<events::OrderLine> lines{ { world.plantIds[i % world.plantIds.size()], world.skus[i % world.skus.size()], "Bench line", 10.0 } };
+            const std::string& customer = world.customerIds[i % world.customerIds.size()];
+            state.ResumeTiming();
+
+            benchmark::DoNotOptimize(world.sales.checkout(customer, lines, 10.0));
+        }
+        state.SetItemsProcessed(state.iterations());
+        setPlants(state, world);
+    }
+
+    void BM_GetCustomerReceipts(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        std::size_t k = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(world.facade->getCustomerReceipts(world.customerIds[k++ % world.customerIds.size()]));
+        }
+        state.SetItemsProcessed(state.iterations());
+        setPlants(state, world);
+    }
+
+    void BM_PersonalizedRecommendations(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        std::size_t k = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(world.facade->getPersonalizedRecommendations(world.customerIds[k++ % world.customerIds.size()]));
+        }
+        state.SetItemsProcessed(state.iterations());
+        setPlants(state, world);
+    }
+
+    void BM_SendMessageToId(benchmark::State& state)
+    {
+        BenchWorld& world = BenchWorld::get(state.range(0));
+        Staff* from = world.staff.getStaff(world.salesStaffIds.front());
+        std::size_t k = 0;
+        for (auto _ : state)
+        {
+            world.messenger.sendMessageToId(from, world.customerIds[k++ % world.customerIds.size()], "Your order is ready");
+        }
+        state.SetItemsProcessed(state.iterations());
+        setPlants(state, world);
+    }
+
+    /// Population sizes, trimmed by NURSERY_BENCH_MAX_PLANTS.
+    std::vector<long> sizes()
+    {
+        long cap = 1000000;
+        if (const char* env = std::getenv("NURSERY_BENCH_MAX_PLANTS")) cap = std::strtol(env, nullptr, 10);
+
+        std::vector<long> out;
+        for (long n = 1000; n <= 1000000 && n <= cap; n *= 10) out.push_back(n);
+        if (out.empty()) out.push_back(1000);
+        return out;
+    }
+
+    void registerAll()
+    {
+        using Fn = void (*)(benchmark::State&);
+        static const std::pair<const char*, Fn> kFamilies[] =
+        {
+            { "Greenhouse/tickAll", BM_TickAll },
+            { "Greenhouse/tickAllLazy", BM_TickAllLazy },
+            { "Greenhouse/receiveShipment", BM_ReceiveShipment },
+            { "Greenhouse/countBySku", BM_CountBySku },
+            { "Greenhouse/createSkuIterator", BM_SkuIterator },
+            { "Greenhouse/createStateIterator", BM_StateIterator },
+            { "Greenhouse/plantsInState", BM_PlantsInState },
+            { "NurseryFacade/refreshRows", BM_RefreshRows<readRow> },
+            { "NurseryFacade/refreshRowsByValue", BM_RefreshRows<readRowByValue> },
+            { "InventoryService/reservePlant", BM_ReservePlant },
+            { "InventoryService/markSold", BM_MarkSold },
+            { "InventoryService/listAvailablePlants", BM_ListAvailablePlants },
+            { "NurseryFacade/availableSnapshot", BM_AvailableSnapshot },
+            { "SalesService/checkout", BM_Checkout },
+            { "NurseryFacade/getCustomerReceipts", BM_GetCustomerReceipts },
+            { "NurseryFacade/getPersonalizedRecommendations", BM_PersonalizedRecommendations },
+            { "ChatMediator/sendMessageToId", BM_SendMessageToId }
+        };
+
+        for (long n : sizes())
+        {
+            for (const auto& family : kFamilies)
+            {
+                benchmark::RegisterBenchmark(family.first, family.second)->Arg(n)->Unit(benchmark::kMicrosecond);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    registerAll();
+
+    // The services log to std::cout/std::cerr on every command; only the report goes to the terminal.
+    std::ostream out(std::cout.rdbuf());
+    std::ostream err(std::cerr.rdbuf());
+    NullBuffer sink;
+    std::cout.rdbuf(&sink);
+    std::cerr.rdbuf(&sink);
+
+    benchmark::ConsoleReporter reporter;
+    reporter.SetOutputStream(&out);
+    reporter.SetErrorStream(&err);
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::Shutdown();
+
+    std::cout.rdbuf(out.rdbuf());
+    std::cerr.rdbuf(err.rdbuf());
+    return 0;
+}
@@ -25,11 +25,17 @@
 #include "SeedlingState.h"
 #include "GrowingState.h"
 #include "MatureState.h"
+#include "WiltingState.h"
+#include "DeadState.h"
 #include "Inventory.h"
 #include "MediterraneanFactory.h"
 #include "DesertFactory.h"
+#include "Iterator.h"
 #include <memory>
+#include <algorithm>
 #include <unordered_set>
+#include <cstdio>
+#include <fstream>
 
 /**
  * Test fixture for NurseryFacade - Tests all 35 public methods
@@ -100,16 +106,16 @@ protected:
     void addTestPlants() 
     {
         for (int i = 1; i <= 3; ++i) {
-            Plant* p = registry->clone("ROSE001", "ROSE001#" + std::to_string(i), "Red");
+            Plant* p = registry->clone("ROSE001", PlantId("ROSE001#" + std::to_string(i)), "Red");
             p->setState(&SeedlingState::getInstance());
-            std::string id = p->id();
+            const PlantId id = p->getPlantId();
             greenhouse->addPlant(std::unique_ptr<Plant>(p));
             inventory->addPlant(id, "ROSE001");
         }
         for (int i = 1; i <= 2; ++i) {
-            Plant* p = registry->clone("CACT001", "CACT001#" + std::to_string(i), "Green");
+            Plant* p = registry->clone("CACT001", PlantId("CACT001#" + std::to_string(i)), "Green");
             p->setState(&GrowingState::getInstance());
-            std::string id = p->id();
+            const PlantId id = p->getPlantId();
             greenhouse->addPlant(std::unique_ptr<Plant>(p));
             inventory->addPlant(id, "CACT001");
         }
@@ -440,7 +446,7 @@ TEST_F(FacadeTestFixture, Checkout_ValidOrder)
 {
     std::vector<events::OrderLine> lines;
     events::OrderLine line;
-    line.plantId = "ROSE001#1";
+    line.plantId = PlantId("ROSE001#1");
     line.speciesSku = "ROSE001";
     line.description = "Rose";
     line.finalCost = 15.0;
@@ -454,7 +460,7 @@ TEST_F(FacadeTestFixture, Checkout_ValidOrder)
 TEST_F(FacadeTestFixture, Checkout_ExactPayment_ZeroChange_AndAssigned) 
 {
     std::vector<events::OrderLine> lines{
-        events::OrderLine{ "ROSE001#2", "ROSE001", "Rose", 15.0 }
+        events::OrderLine{ PlantId("ROSE001#2"), "ROSE001", "Rose", 15.0 }
     };
 
     Receipt receipt = facade->checkout("cust001", lines, 15.0);
@@ -472,7 +478,7 @@ TEST_F(FacadeTestFixture, Checkout_ExactPayment_ZeroChange_AndAssigned)
 TEST_F(FacadeTestFixture, Checkout_NoItemsAvailable_InvalidPlant) 
 {
     std::vector<events::OrderLine> lines{
-        events::OrderLine{ "INVALID#1", "ROSE001", "Rose", 15.0 }
+        events::OrderLine{ PlantId("INVALID#1"), "ROSE001", "Rose", 15.0 }
     };
     Receipt receipt = facade->checkout("cust001", lines, 20.0);
     EXPECT_FALSE(receipt.success);
@@ -483,8 +489,8 @@ TEST_F(FacadeTestFixture, Checkout_NoItemsAvailable_InvalidPlant)
 TEST_F(FacadeTestFixture, Checkout_PartialAvailability_Succeeds_WithOneValid) 
 {
     std::vector<events::OrderLine> lines{
-        events::OrderLine{ "ROSE001#3", "ROSE001", "Rose", 15.0 },
-        events::OrderLine{ "INVALID#2", "ROSE001", "Rose", 15.0 }
+        events::OrderLine{ PlantId("ROSE001#3"), "ROSE001", "Rose", 15.0 },
+        events::OrderLine{ PlantId("INVALID#2"), "ROSE001", "Rose", 15.0 }
     };
     Receipt receipt = facade->checkout("cust001", lines, 30.0);
     ASSERT_TRUE(receipt.success);
@@ -492,17 +498,155 @@ TEST_F(FacadeTestFixture, Checkout_PartialAvailability_Succeeds_WithOneValid)
     EXPECT_DOUBLE_EQ(receipt.change, 15.0);
 }
 
+// A batch reservation reports every line and, when asked, reserves nothing unless all lines succeed.
+TEST_F(FacadeTestFixture, ReserveBatch_PerLineResultsAndAllOrNothing)
+{
+    EXPECT_TRUE(inventory->reservePlant(PlantId("CACT001#2")));
+    std::vector<PlantId> ids{ PlantId("ROSE001#2"), PlantId("INVALID#1"), PlantId("ROSE001#1"), PlantId("CACT001#2"), PlantId("ROSE001#2") };
+
+    std::vector<ReserveResult> strict = inventory->reserveBatch(ids, true);
+    EXPECT_EQ(strict, (std::vector<ReserveResult>{ ReserveResult::Skipped, ReserveResult::NotFound, ReserveResult::Skipped,
+                                                   ReserveResult::Unavailable, ReserveResult::Duplicate }));
+    EXPECT_EQ(inventory->reservedCount("ROSE001"), 0);
+
+    std::vector<ReserveResult> partial = inventory->reserveBatch(ids);
+    EXPECT_EQ(partial, (std::vector<ReserveResult>{ ReserveResult::Reserved, ReserveResult::NotFound, ReserveResult::Reserved,
+                                                    ReserveResult::Unavailable, ReserveResult::Duplicate }));
+    EXPECT_EQ(inventory->reservedCount("ROSE001"), 2);
+    EXPECT_EQ(inventory->availableCount("ROSE001"), 1);
+    EXPECT_TRUE(inventory->reserveBatch({}).empty());
+
+    std::vector<events::OrderLine> lines{
+        events::OrderLine{ PlantId("ROSE001#3"), "ROSE001", "Rose", 15.0 },
+        events::OrderLine{ PlantId("ROSE001#1"), "ROSE001", "Rose", 15.0 }
+    };
+    Receipt failed = facade->checkout("cust001", lines, 30.0, true);
+    EXPECT_FALSE(failed.success);
+    EXPECT_EQ(failed.message, "Items no longer available: ROSE001#1");
+    EXPECT_EQ(inventory->availableCount("ROSE001"), 1);
+
+    lines.pop_back();
+    EXPECT_TRUE(facade->checkout("cust001", lines, 30.0, true).success);
+}
+
+// Quantity purchases take plants straight from the species' stock, oldest or healthiest first.
+TEST_F(FacadeTestFixture, ReserveAnyOfSku_PicksOldestOrHealthiest)
+{
+    EXPECT_TRUE(inventory->reserveAnyOfSku("ROSE001", 4).empty());
+    EXPECT_TRUE(inventory->reserveAnyOfSku("UNKNOWN", 1).empty());
+    EXPECT_TRUE(inventory->reserveAnyOfSku("ROSE001", 0).empty());
+    EXPECT_EQ(inventory->availableCount("ROSE001"), 3);
+
+    EXPECT_EQ(inventory->reserveAnyOfSku("ROSE001", 2), (std::vector<PlantId>{ PlantId("ROSE001#1"), PlantId("ROSE001#2") }));
+    EXPECT_EQ(inventory->reservedCount("ROSE001"), 2);
+    inventory->releasePlantFromOrder(PlantId("ROSE001#1"));
+    inventory->releasePlantFromOrder(PlantId("ROSE001#2"));
+
+    greenhouse->getPlant(PlantId("ROSE001#1"))->addHealth(-50);
+    greenhouse->getPlant(PlantId("ROSE001#2"))->addHealth(-50);
+    greenhouse->getPlant(PlantId("ROSE001#2"))->addHealth(20);
+    EXPECT_EQ(inventory->reserveAnyOfSku("ROSE001", 2, PickOrder::Healthiest),
+              (std::vector<PlantId>{ PlantId("ROSE001#3"), PlantId("ROSE001#2") }));
+    EXPECT_EQ(inventory->availableCount("ROSE001"), 1);
+}
+
+// Buying a quantity of a species completes a normal order without naming plants.
+TEST_F(FacadeTestFixture, CheckoutBySku_ReservesAndSellsQuantity)
+{
+    Receipt shortStock = facade->checkoutBySku("cust001", "CACT001", 3, 1000.0);
+    EXPECT_FALSE(shortStock.success);
+    EXPECT_EQ(shortStock.message, "Only 2 of CACT001 in stock");
+
+    Receipt underpaid = facade->checkoutBySku("cust001", "CACT001", 2, 0.0);
+    EXPECT_FALSE(underpaid.success);
+    EXPECT_EQ(inventory->availableCount("CACT001"), 2);
+
+    Receipt receipt = facade->checkoutBySku("cust001", "CACT001", 2, 1000.0);
+    ASSERT_TRUE(receipt.success);
+    EXPECT_GT(receipt.totalCost, 0.0);
+    EXPECT_EQ(inventory->reservedCount("CACT001"), 2);
+    EXPECT_EQ(inventory->availableCount("CACT001"), 0);
+    EXPECT_EQ(facade->checkoutBySku("invalid_user", "ROSE001", 1, 100.0).message, "Invalid customer");
+}
+
+// The available list is shared while nothing changes and patched from the inventory's journal after.
+TEST_F(FacadeTestFixture, AvailableSnapshot_PatchedFromInventoryChanges)
+{
+    auto sortedIds = [](const std::vector<Plant*>& plants)
+    {
+        std::vector<PlantId> out;
+        for (Plant* p : plants) out.push_back(p->getPlantId());
+        std::sort(out.begin(), out.end());
+        return out;
+    };
+    auto expectedIds = [this]()
+    {
+        std::vector<PlantId> out = inventory->listAvailablePlants();
+        std::sort(out.begin(), out.end());
+        return out;
+    };
+
+    PlantSnapshot before = facade->availableSnapshot();
+    const std::uint64_t generation = facade->availableGeneration();
+    EXPECT_EQ(facade->availableSnapshot(), before);
+    EXPECT_EQ(facade->availableGeneration(), generation);
+    EXPECT_EQ(sortedIds(*before), expectedIds());
+
+    const std::uint64_t inventoryGen = inventory->availableGeneration();
+    ASSERT_TRUE(inventory->reservePlant(PlantId("ROSE001#1")));
+    std::vector<Inventory::AvailableChange> changes;
+    ASSERT_TRUE(inventory->availableChangesSince(inventoryGen, changes));
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].plantId, PlantId("ROSE001#1"));
+    EXPECT_FALSE(changes[0].added);
+    EXPECT_FALSE(inventory->availableChangesSince(inventoryGen + 2, changes));
+
+    PlantSnapshot after = facade->availableSnapshot();
+    EXPECT_NE(after, before);
+    EXPECT_NE(facade->availableGeneration(), generation);
+    EXPECT_EQ(after->size() + 1, before->size());
+    EXPECT_EQ(std::count(after->begin(), after->end(), greenhouse->getPlant(PlantId("ROSE001#1"))), 0);
+    EXPECT_EQ(sortedIds(*after), expectedIds());
+
+    inventory->releasePlantFromOrder(PlantId("ROSE001#1"));
+    EXPECT_EQ(sortedIds(facade->browseAvailable()), expectedIds());
+
+    // Once the journal has moved past a generation, the list is rebuilt instead.
+    const std::uint64_t oldGen = inventory->availableGeneration();
+    for (int i = 0; i < 5000; ++i)
+    {
+        inventory->reservePlant(PlantId("CACT001#1"));
+        inventory->releasePlantFromOrder(PlantId("CACT001#1"));
+    }
+    inventory->reservePlant(PlantId("CACT001#2"));
+    EXPECT_FALSE(inventory->availableChangesSince(oldGen, changes));
+    EXPECT_EQ(sortedIds(*facade->availableSnapshot()), expectedIds());
+}
+
+// Paying exactly the quoted price per plant is enough for a quantity checkout.
+TEST_F(FacadeTestFixture, CheckoutBySku_PaysExactlyTheQuotedPrice)
+{
+    const double price = facade->getSkuPrice("CACT001");
+    EXPECT_EQ(price, greenhouse->getPlant(PlantId("CACT001#1"))->cost());
+    EXPECT_EQ(facade->getSkuPrice("UNKNOWN"), 0.0);
+
+    Receipt receipt = facade->checkoutBySku("cust001", "CACT001", 2, price * 2);
+    ASSERT_TRUE(receipt.success) << receipt.message;
+    EXPECT_DOUBLE_EQ(receipt.totalCost, price * 2);
+    EXPECT_DOUBLE_EQ(receipt.change, 0.0);
+}
+
 // Reserving the same plant twice should fail the second time.
 TEST_F(FacadeTestFixture, Checkout_DoubleReserve_SamePlant_FailsSecondTime) 
 {
     std::vector<events::OrderLine> first{
-        events::OrderLine{ "ROSE001#1", "ROSE001", "Rose", 15.0 }
+        events::OrderLine{ PlantId("ROSE001#1"), "ROSE001", "Rose", 15.0 }
     };
     Receipt firstReceipt = facade->checkout("cust001", first, 20.0);
     ASSERT_TRUE(firstReceipt.success);
 
     std::vector<events::OrderLine> second{
-        events::OrderLine{ "ROSE001#1", "ROSE001", "Rose", 15.0 }
+        events::OrderLine{ PlantId("ROSE001#1"), "ROSE001", "Rose", 15.0 }
     };
     Receipt secondReceipt = facade->checkout("cust001", second, 20.0);
     EXPECT_FALSE(secondReceipt.success);
@@ -525,7 +669,7 @@ TEST_F(FacadeTestFixture, Checkout_NullServices_ServiceUnavailable)
 
     NurseryFacade nullFacade(nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
     std::vector<events::OrderLine> lines{
-        events::OrderLine{ "ROSE001#99", "ROSE001", "Rose", 15.0 }
+        events::OrderLine{ PlantId("ROSE001#99"), "ROSE001", "Rose", 15.0 }
     };
     Receipt r = nullFacade.checkout("cust001", lines, 20.0);
     EXPECT_FALSE(r.success);
@@ -537,7 +681,7 @@ TEST_F(FacadeTestFixture, GetCustomerReceipts)
 {
     std::vector<events::OrderLine> lines;
     events::OrderLine line;
-    line.plantId = "ROSE001#1";
+    line.plantId = PlantId("ROSE001#1");
     line.speciesSku = "ROSE001";
     line.description = "Rose";
     line.finalCost = 15.0;
@@ -574,7 +718,7 @@ TEST_F(FacadeTestFixture, GetCustomerOrders)
 {
     std::vector<events::OrderLine> lines;
     events::OrderLine line;
-    line.plantId = "ROSE001#2";
+    line.plantId = PlantId("ROSE001#2");
     line.speciesSku = "ROSE001";
     line.description = "Rose";
     line.finalCost = 15.0;
@@ -611,7 +755,7 @@ TEST_F(FacadeTestFixture, GetStaffOrders_AfterCheckout_ReturnsAssignedOrder)
 {
 
     std::vector<events::OrderLine> lines{
-        events::OrderLine{ "ROSE001#1", "ROSE001", "Rose", 15.0 }
+        events::OrderLine{ PlantId("ROSE001#1"), "ROSE001", "Rose", 15.0 }
     };
     Receipt receipt = facade->checkout("cust001", lines, 20.0);
     ASSERT_TRUE(receipt.success);
@@ -649,7 +793,7 @@ TEST_F(FacadeTestFixture, CompleteOrder_Valid_CompletesAndRemovesPlant)
 {
     
     std::vector<events::OrderLine> lines{
-        events::OrderLine{ "ROSE001#2", "ROSE001", "Rose", 15.0 }
+        events::OrderLine{ PlantId("ROSE001#2"), "ROSE001", "Rose", 15.0 }
     };
     int soldBefore = inventory->soldCount("ROSE001");
     Receipt receipt = facade->checkout("cust001", lines, 20.0);
@@ -663,7 +807,7 @@ TEST_F(FacadeTestFixture, CompleteOrder_Valid_CompletesAndRemovesPlant)
     ASSERT_TRUE(orderOpt.has_value());
     EXPECT_EQ(orderOpt->status, events::OrderStatus::Completed);
 
-    EXPECT_EQ(greenhouse->getPlant("ROSE001#2"), nullptr);
+    EXPECT_EQ(greenhouse->getPlant(PlantId("ROSE001#2")), nullptr);
     int soldAfter = inventory->soldCount("ROSE001");
     EXPECT_EQ(soldAfter, soldBefore + 1);
 }
@@ -672,7 +816,7 @@ TEST_F(FacadeTestFixture, CompleteOrder_Valid_CompletesAndRemovesPlant)
 TEST_F(FacadeTestFixture, CompleteOrder_AlreadyCompleted_ReturnsFalse) 
 {
     std::vector<events::OrderLine> lines{
-        events::OrderLine{ "ROSE001#3", "ROSE001", "Rose", 15.0 }
+        events::OrderLine{ PlantId("ROSE001#3"), "ROSE001", "Rose", 15.0 }
     };
     Receipt receipt = facade->checkout("cust001", lines, 20.0);
     ASSERT_TRUE(receipt.success);
@@ -1538,7 +1682,7 @@ TEST_F(FacadeTestFixture, PersonalizedRecommendations_NullServices_ReturnsEmpty)
 TEST_F(FacadeTestFixture, Checkout_InsufficientPayment) 
 {
     std::vector<events::OrderLine> lines{
-        events::OrderLine{ "ROSE001#1", "ROSE001", "Rose", 15.0 }
+        events::OrderLine{ PlantId("ROSE001#1"), "ROSE001", "Rose", 15.0 }
     };
     Receipt receipt = facade->checkout("cust001", lines, 10.0);
     EXPECT_FALSE(receipt.success);
@@ -1556,7 +1700,7 @@ TEST_F(FacadeTestFixture, Checkout_EmptyCart)
 TEST_F(FacadeTestFixture, Checkout_InvalidCustomer) 
 {
     std::vector<events::OrderLine> lines{
-        events::OrderLine{ "ROSE001#2", "ROSE001", "Rose", 15.0 }
+        events::OrderLine{ PlantId("ROSE001#2"), "ROSE001", "Rose", 15.0 }
     };
     Receipt receipt = facade->checkout("invalid_user", lines, 20.0);
     EXPECT_FALSE(receipt.success);
@@ -1679,7 +1823,7 @@ TEST_F(FacadeTestFixture, PersonalizedRecommendations_WithEmptyGreenhouse_Return
 // Recommendations should exclude items already purchased.
 TEST_F(FacadeTestFixture, PersonalizedRecommendations_AfterCheckout_ExcludesPurchased) 
 {
-    std::vector<events::OrderLine> lines{ events::OrderLine{ "ROSE001#1", "ROSE001", "Rose", 15.0 } };
+    std::vector<events::OrderLine> lines{ events::OrderLine{ PlantId("ROSE001#1"), "ROSE001", "Rose", 15.0 } };
     Receipt r = facade->checkout("cust001", lines, 20.0);
     ASSERT_TRUE(r.success);
     auto recs = facade->getPersonalizedRecommendations("cust001");
@@ -1692,7 +1836,7 @@ TEST_F(FacadeTestFixture, PersonalizedRecommendations_AfterCheckout_ExcludesPurc
 // After completing an order, recommendations still return other items.
 TEST_F(FacadeTestFixture, PersonalizedRecommendations_AfterCompletedOrder_StillReturns) 
 {
-    std::vector<events::OrderLine> lines{ events::OrderLine{ "ROSE001#2", "ROSE001", "Rose", 15.0 } };
+    std::vector<events::OrderLine> lines{ events::OrderLine{ PlantId("ROSE001#2"), "ROSE001", "Rose", 15.0 } };
     Receipt r = facade->checkout("cust001", lines, 20.0);
     ASSERT_TRUE(r.success);
     ASSERT_TRUE(facade->completeOrder(r.orderId));
@@ -1800,6 +1944,712 @@ TEST_F(FacadeTestFixture, PersonalizedRecommendations_SizeCappedAndUnique)
     EXPECT_EQ(ids.size(), recs.size());
 }
 
+// Parallel ticking replays transitions in the same order and leaves the same plant values as serial ticking.
+TEST_F(FacadeTestFixture, TickAll_ParallelMatchesSerial) 
+{
+    struct Recorder : NurseryObserver
+    {
+        std::vector<std::string> seen;
+        void onEvent(events::Plant e) override { seen.push_back(e.plantId.str() + ":" + std::to_string(static_cast<int>(e.type))); }
+    };
+
+    Greenhouse serial(registry.get());
+    Greenhouse parallel(registry.get());
+    Recorder serialLog;
+    Recorder parallelLog;
+    serial.addObserver(&serialLog);
+    parallel.addObserver(&parallelLog);
+    parallel.setTickThreads(4);
+    EXPECT_EQ(parallel.getTickThreads(), 4u);
+
+    PlantState* states[] = { &SeedlingState::getInstance(), &GrowingState::getInstance(),
+                             &MatureState::getInstance(), &WiltingState::getInstance() };
+    const int count = 20000;
+    for (Greenhouse* gh : { &serial, &parallel })
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            Plant* p = registry->clone(i % 2 ? "ROSE001" : "CACT001", PlantId("PAR#" + std::to_string(i)), "Red");
+            p->setState(states[i % 4]);
+            p->addWater(i % 101);
+            p->addInsecticide(-(i % 97));
+            p->addHealth(-(i % 89));
+            gh->addPlant(std::unique_ptr<Plant>(p));
+        }
+    }
+
+    for (int t = 0; t < 5; ++t)
+    {
+        serial.tickAll();
+        parallel.tickAll();
+    }
+
+    EXPECT_FALSE(serialLog.seen.empty());
+    EXPECT_EQ(serialLog.seen, parallelLog.seen);
+    for (int i = 0; i < count; ++i)
+    {
+        const PlantId id("PAR#" + std::to_string(i));
+        Plant* a = serial.getPlant(id);
+        Plant* b = parallel.getPlant(id);
+        ASSERT_EQ(a == nullptr, b == nullptr);
+        if (!a) continue;
+        EXPECT_EQ(a->getMoisture(), b->getMoisture());
+        EXPECT_EQ(a->getHealth(), b->getHealth());
+        EXPECT_EQ(a->getInsecticide(), b->getInsecticide());
+        EXPECT_EQ(a->getPlantState(), b->getPlantState());
+    }
+}
+
+// Lazy ticking skips idle plants but produces the same events and plant values as full ticking.
+TEST_F(FacadeTestFixture, TickAll_LazyMatchesFull) 
+{
+    struct Recorder : NurseryObserver
+    {
+        std::vector<std::string> seen;
+        void onEvent(events::Plant e) override { seen.push_back(e.plantId.str() + ":" + std::to_string(static_cast<int>(e.type))); }
+    };
+
+    VirtualClock clock;
+    SimClock* previous = SimClock::install(&clock);
+
+    Greenhouse full(registry.get());
+    Greenhouse lazy(registry.get());
+    Recorder fullLog;
+    Recorder lazyLog;
+    full.addObserver(&fullLog);
+    lazy.addObserver(&lazyLog);
+    lazy.setLazyTick(true);
+    EXPECT_TRUE(lazy.isLazyTick());
+
+    PlantState* states[] = { &SeedlingState::getInstance(), &GrowingState::getInstance(),
+                             &MatureState::getInstance(), &WiltingState::getInstance() };
+    const int count = 3000;
+    for (Greenhouse* gh : { &full, &lazy })
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            Plant* p = registry->clone(i % 2 ? "ROSE001" : "CACT001", PlantId("LAZY#" + std::to_string(i)), "Red");
+            p->setState(states[i % 3 == 0 ? i % 4 : 2]);
+            p->addWater(i % 101);
+            p->addInsecticide(-(i % 97));
+            p->addHealth(-(i % 89));
+            gh->addPlant(std::unique_ptr<Plant>(p));
+        }
+    }
+
+    std::uint32_t maxSleeping = 0;
+    for (int t = 0; t < 60; ++t)
+    {
+        clock.advanceDays(1);
+        full.tickAll();
+        lazy.tickAll();
+        maxSleeping = std::max(maxSleeping, lazy.getSleepingCount());
+
+        // Reads settle sleeping plants without waking them; care wakes them.
+        for (int i = t % 7; i < count; i += 37)
+        {
+            const PlantId id("LAZY#" + std::to_string(i));
+            Plant* a = full.getPlant(id);
+            Plant* b = lazy.getPlant(id);
+            ASSERT_EQ(a == nullptr, b == nullptr);
+            if (!a) continue;
+            EXPECT_EQ(a->getMoisture(), b->getMoisture());
+            if (t % 10 == 0)
+            {
+                a->addWater(40);
+                b->addWater(40);
+                a->addInsecticide(30);
+                b->addInsecticide(30);
+            }
+        }
+    }
+    SimClock::install(previous);
+
+    EXPECT_GT(maxSleeping, 0u);
+    EXPECT_FALSE(fullLog.seen.empty());
+    EXPECT_EQ(fullLog.seen, lazyLog.seen);
+    for (int i = 0; i < count; ++i)
+    {
+        const PlantId id("LAZY#" + std::to_string(i));
+        Plant* a = full.getPlant(id);
+        Plant* b = lazy.getPlant(id);
+        ASSERT_EQ(a == nullptr, b == nullptr);
+        if (!a) continue;
+        EXPECT_EQ(a->getMoisture(), b->getMoisture());
+        EXPECT_EQ(a->getHealth(), b->getHealth());
+        EXPECT_EQ(a->getInsecticide(), b->getInsecticide());
+        EXPECT_EQ(a->getPlantState(), b->getPlantState());
+    }
+    EXPECT_EQ(full.countByState(&MatureState::getInstance()), lazy.countByState(&MatureState::getInstance()));
+
+    lazy.setLazyTick(false);
+    EXPECT_EQ(lazy.getSleepingCount(), 0u);
+}
+
+// A virtual clock lets a month of greenhouse life run without waiting for the wall clock.
+TEST_F(FacadeTestFixture, TickAll_VirtualClockMaturesPlantsOverAMonth) 
+{
+    VirtualClock clock;
+    SimClock* previous = SimClock::install(&clock);
+
+    auto plants = facade->listAllPlants();
+    ASSERT_EQ(plants.size(), 5u);
+    for (int day = 0; day < 30; ++day)
+    {
+        clock.advanceDays(1);
+        for (Plant* p : plants)
+        {
+            p->addWater(100);
+            p->addInsecticide(100);
+        }
+        greenhouse->tickAll();
+    }
+
+    for (Plant* p : plants)
+    {
+        EXPECT_GE(p->getAgeDays(), 30);
+        EXPECT_TRUE(p->getPlantState()->isMature()) << p->id() << " is " << p->getPlantState()->name();
+    }
+    SimClock::install(previous);
+}
+
+// Test: SKU counts and SKU iteration follow shipments, removals and replacements
+TEST_F(FacadeTestFixture, SkuIndex_TracksShipmentsRemovalsAndReplacements)
+{
+    EXPECT_EQ(greenhouse->countBySku("ROSE001"), 3);
+    EXPECT_EQ(greenhouse->countBySku("CACT001"), 2);
+    EXPECT_EQ(greenhouse->countBySku("UNKNOWN"), 0);
+
+    // The shipment's ids continue at CACT001#1, so the two that are already taken are dropped.
+    greenhouse->receiveShipment("CACT001", 4);
+    EXPECT_EQ(greenhouse->countBySku("CACT001"), 4);
+
+    EXPECT_TRUE(greenhouse->removePlant(PlantId("ROSE001#2")));
+    EXPECT_FALSE(greenhouse->removePlant(PlantId("ROSE001#2")));
+    EXPECT_EQ(greenhouse->countBySku("ROSE001"), 2);
+
+    // Re-adding an existing id replaces the plant rather than counting it twice.
+    Plant* replacement = registry->clone("ROSE001", PlantId("ROSE001#1"), "White");
+    greenhouse->addPlant(std::unique_ptr<Plant>(replacement));
+    EXPECT_EQ(greenhouse->countBySku("ROSE001"), 2);
+
+    std::unordered_set<std::string> seen;
+    std::unique_ptr<Iterator> it(greenhouse->createSkuIterator("ROSE001"));
+    for (it->first(); !it->isDone(); it->next())
+    {
+        ASSERT_NE(it->currentItem(), nullptr);
+        EXPECT_EQ(it->currentItem()->sku(), "ROSE001");
+        seen.insert(it->currentItem()->id());
+    }
+    EXPECT_EQ(seen, (std::unordered_set<std::string>{ "ROSE001#1", "ROSE001#3" }));
+    EXPECT_EQ(greenhouse->getPlant(PlantId("ROSE001#1")), replacement);
+
+    std::unique_ptr<Iterator> none(greenhouse->createSkuIterator("UNKNOWN"));
+    EXPECT_TRUE(none->isDone());
+    EXPECT_EQ(none->currentItem(), nullptr);
+}
+
+// Test: per-state counts and state iterators agree with a full scan through setState and ticks
+TEST_F(FacadeTestFixture, StateBuckets_FollowSetStateAndTicks)
+{
+    PlantState* states[] = { &SeedlingState::getInstance(), &GrowingState::getInstance(),
+                             &MatureState::getInstance(), &WiltingState::getInstance(),
+                             &DeadState::getInstance() };
+    auto expectMatchesScan = [&]()
+    {
+        auto plants = facade->listAllPlants();
+        for (PlantState* state : states)
+        {
+            int scanned = 0;
+            for (Plant* p : plants) if (p->getPlantState() == state) ++scanned;
+            EXPECT_EQ(facade->getStateCount(state), scanned) << state->name();
+
+            int iterated = 0;
+            std::unique_ptr<Iterator> it(greenhouse->createStateIterator(state));
+            for (it->first(); !it->isDone(); it->next())
+            {
+                EXPECT_EQ(it->currentItem()->getPlantState(), state);
+                ++iterated;
+            }
+            EXPECT_EQ(iterated, scanned) << state->name();
+        }
+    };
+
+    EXPECT_EQ(facade->getStateCount(&SeedlingState::getInstance()), 3);
+    EXPECT_EQ(facade->getStateCount(&GrowingState::getInstance()), 2);
+    EXPECT_EQ(facade->getStateCount(nullptr), 0);
+
+    facade->getPlant("ROSE001#2")->setState(&WiltingState::getInstance());
+    facade->getPlant("CACT001#1")->setState(&MatureState::getInstance());
+    EXPECT_EQ(facade->getStateCount(&WiltingState::getInstance()), 1);
+    expectMatchesScan();
+
+    greenhouse->receiveShipment("ROSE001", 6);
+    facade->getPlant("ROSE001#3")->addHealth(-100);
+    VirtualClock clock;
+    SimClock* previous = SimClock::install(&clock);
+    for (int day = 0; day < 15; ++day)
+    {
+        clock.advanceDays(1);
+        greenhouse->tickAll();
+        expectMatchesScan();
+    }
+    SimClock::install(previous);
+
+    greenhouse->removePlant(PlantId("CACT001#1"));
+    expectMatchesScan();
+}
+
+// Test: iterators share one snapshot per generation, and a mutation starts a new one
+TEST_F(FacadeTestFixture, Snapshots_SharedUntilPlantsChange)
+{
+    SpeciesIndex rose = SkuTable::find("ROSE001");
+    PlantSnapshot all = greenhouse->snapshot();
+    PlantSnapshot roses = greenhouse->skuSnapshot(rose);
+    PlantSnapshot seedlings = greenhouse->stateSnapshot(&SeedlingState::getInstance());
+    EXPECT_EQ(greenhouse->snapshot(), all);
+    EXPECT_EQ(greenhouse->skuSnapshot(rose), roses);
+    EXPECT_EQ(greenhouse->stateSnapshot(&SeedlingState::getInstance()), seedlings);
+
+    std::unique_ptr<Iterator> before = greenhouse->createIterator();
+    EXPECT_EQ(all.use_count(), 3);  // ours, the cache's and the iterator's
+
+    // Ids CACT001#1 and #2 are taken by the fixture, so only #3 and #4 are added.
+    PlantSnapshot cacti = greenhouse->skuSnapshot(SkuTable::find("CACT001"));
+    greenhouse->receiveShipment("CACT001", 4);
+    EXPECT_NE(greenhouse->snapshot(), all);
+    EXPECT_EQ(greenhouse->snapshot()->size(), all->size() + 2);
+    EXPECT_EQ(greenhouse->skuSnapshot(SkuTable::find("CACT001"))->size(), cacti->size() + 2);
+    EXPECT_EQ(greenhouse->skuSnapshot(rose), roses);
+
+    // The old generation is untouched and still walks the plants it was built from.
+    std::size_t visited = 0;
+    for (before->first(); !before->isDone(); before->next()) ++visited;
+    EXPECT_EQ(visited, all->size());
+
+    PlantSnapshot mature = greenhouse->stateSnapshot(&MatureState::getInstance());
+    facade->getPlant("ROSE001#1")->setState(&MatureState::getInstance());
+    EXPECT_NE(greenhouse->stateSnapshot(&MatureState::getInstance()), mature);
+    EXPECT_EQ(greenhouse->stateSnapshot(&MatureState::getInstance())->size(), mature->size() + 1);
+    EXPECT_EQ(greenhouse->skuSnapshot(rose), roses);
+
+    EXPECT_TRUE(greenhouse->removePlant(PlantId("ROSE001#2")));
+    EXPECT_NE(greenhouse->skuSnapshot(rose), roses);
+    EXPECT_EQ(greenhouse->skuSnapshot(rose)->size(), roses->size() - 1);
+    EXPECT_TRUE(greenhouse->skuSnapshot(kNoSpecies)->empty());
+    EXPECT_TRUE(greenhouse->stateSnapshot(nullptr)->empty());
+}
+
+// Test: range views yield the same plants as the Iterator classes and compose with where()
+TEST_F(FacadeTestFixture, PlantViews_MatchIteratorsAndCompose)
+{
+    auto collect = [](auto range)
+    {
+        std::unordered_set<Plant*> out;
+        for (Plant* p : range) out.insert(p);
+        return out;
+    };
+    auto iterate = [](std::unique_ptr<Iterator> it)
+    {
+        std::unordered_set<Plant*> out;
+        for (it->first(); !it->isDone(); it->next()) out.insert(it->currentItem());
+        return out;
+    };
+
+    greenhouse->removePlant(PlantId("ROSE001#2"));
+    facade->getPlant("CACT001#1")->setState(&MatureState::getInstance());
+
+    EXPECT_EQ(collect(greenhouse->plants()), iterate(greenhouse->createIterator()));
+    EXPECT_EQ(collect(greenhouse->plants()).size(), 4u);
+    EXPECT_EQ(greenhouse->getPlantCount(), 4);
+    PlantState* states[] = { &SeedlingState::getInstance(), &GrowingState::getInstance(), &MatureState::getInstance() };
+    for (PlantState* state : states)
+    {
+        EXPECT_EQ(collect(greenhouse->plantsInState(state)), iterate(greenhouse->createStateIterator(state))) << state->name();
+    }
+    EXPECT_EQ(collect(greenhouse->plantsOfSku("ROSE001")), iterate(greenhouse->createSkuIterator("ROSE001")));
+    EXPECT_TRUE(greenhouse->plantsOfSku("UNKNOWN").empty());
+    EXPECT_TRUE(greenhouse->plantsInState(nullptr).empty());
+
+    auto matureCacti = greenhouse->plantsOfSku("CACT001")
+                           .where([](Plant* p) { return p->getPlantState() == &MatureState::getInstance(); })
+                           .where([](Plant* p) { return p->id() == "CACT001#1"; });
+    EXPECT_EQ(collect(matureCacti), (std::unordered_set<Plant*>{ facade->getPlant("CACT001#1") }));
+
+    std::vector<Plant*> listed = facade->listAllPlants();
+    EXPECT_EQ(collect(viewOf(listed).where([](Plant* p) { return p->sku() == "ROSE001"; })),
+              collect(greenhouse->plantsOfSku("ROSE001")));
+}
+
+// A null state matches no plant, even while some plants are dead.
+TEST_F(FacadeTestFixture, StateQueries_EmptyForNullState)
+{
+    facade->getPlant("ROSE001#1")->setState(&DeadState::getInstance());
+    ASSERT_EQ(greenhouse->countByState(&DeadState::getInstance()), 1);
+
+    EXPECT_EQ(greenhouse->countByState(nullptr), 0);
+    EXPECT_TRUE(greenhouse->plantsInState(nullptr).empty());
+    EXPECT_TRUE(greenhouse->stateSnapshot(nullptr)->empty());
+    std::unique_ptr<Iterator> it = greenhouse->createStateIterator(nullptr);
+    it->first();
+    EXPECT_TRUE(it->isDone());
+    EXPECT_EQ(PlantStore::indexOf(nullptr), PlantStore::kStateCount);
+}
+
+// PlantId: the same text always interns to the same handle and formats back unchanged
+TEST(PlantIdTest, InternsAndFormatsRoundTrip)
+{
+    PlantId a("IDTEST#7");
+    PlantId b = PlantId::make("IDTEST", 7);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.str(), "IDTEST#7");
+    EXPECT_NE(a, PlantId("IDTEST#8"));
+    EXPECT_NE(a, PlantId("IDTEST#07"));
+    EXPECT_NE(a, PlantId("OTHER#7"));
+
+    // Ids outside the "SKU#n" shape are kept as text.
+    for (const char* text : { "IDTEST#07", "IDTEST#0", "#3", "IDTEST#", "plain", "IDTEST#99999999" })
+    {
+        EXPECT_EQ(PlantId(text).str(), text);
+        EXPECT_EQ(PlantId(text), PlantId(std::string(text)));
+    }
+
+    PlantId empty("");
+    EXPECT_FALSE(empty.valid());
+    EXPECT_EQ(empty, PlantId());
+    EXPECT_EQ(empty.str(), "");
+}
+
+// The generator hands out ids per SKU in sequence, and a reserved range matches one-by-one ids
+TEST(PlantIdTest, GeneratorReservesRangesAndAppendsText)
+{
+    SpeciesIndex gen = SkuTable::intern("GENTEST");
+    PlantIdGenerator ids;
+    EXPECT_EQ(ids.issued(gen), 0u);
+    EXPECT_EQ(ids.next(gen), PlantId("GENTEST#1"));
+
+    PlantIdRange range = ids.reserve(gen, 1000);
+    EXPECT_EQ(range.size(), 1000u);
+    EXPECT_EQ(range.firstSeq(), 2u);
+    EXPECT_EQ(range[0], PlantId("GENTEST#2"));
+    EXPECT_EQ(range[999], PlantId::make(gen, 1001));
+    EXPECT_EQ(ids.next(gen).str(), "GENTEST#1002");
+    EXPECT_EQ(ids.issued(gen), 1002u);
+    EXPECT_EQ(ids.issued(kNoSpecies), 0u);
+
+    std::string buffer = "id=";
+    range[8].appendTo(buffer);
+    buffer += ',';
+    PlantId("plain").appendTo(buffer);
+    PlantId().appendTo(buffer);
+    EXPECT_EQ(buffer, "id=GENTEST#10,plain");
+}
+
+// Looking up ids that were never created adds nothing to the intern table or the SkuTable
+TEST_F(FacadeTestFixture, PlantIdFind_UnknownIdsAreNotInterned)
+{
+    PlantId known("FINDTEST#3");
+    PlantId plain("find-plain");
+    EXPECT_EQ(PlantId::find("FINDTEST#3"), known);
+    EXPECT_EQ(PlantId::find("find-plain"), plain);
+    EXPECT_EQ(PlantId::find("ROSE001#1"), facade->getPlant("ROSE001#1")->getPlantId());
+
+    const std::size_t skus = SkuTable::size();
+    const std::uint32_t before = PlantId("find-before").value();
+    for (int i = 0; i < 100; ++i)
+    {
+        const std::string typo = "TYPO" + std::to_string(i) + "#7";
+        EXPECT_FALSE(PlantId::find(typo).valid());
+        EXPECT_EQ(facade->getPlant(typo), nullptr);
+    }
+    EXPECT_FALSE(PlantId::find("FINDTEST#4").valid());
+    EXPECT_FALSE(PlantId::find("").valid());
+    EXPECT_EQ(SkuTable::size(), skus);
+    EXPECT_EQ(PlantId("find-after").value(), before + 1);
+}
+
+// An id first seen too far ahead is kept as text, and the generator reaching it later gets that handle
+TEST(PlantIdTest, SparseIdKeepsOneHandleWhenSequenceCatchesUp)
+{
+    SpeciesIndex sparse = SkuTable::intern("SPARSETEST");
+    PlantId early("SPARSETEST#5000");
+    PlantIdGenerator ids;
+    ids.reserve(sparse, 4998);
+    PlantId reached = ids.next(sparse);
+    EXPECT_EQ(reached.str(), "SPARSETEST#4999");
+    PlantId late = ids.next(sparse);
+    EXPECT_EQ(late, early);
+    EXPECT_EQ(PlantId::make("SPARSETEST", 5000), early);
+    EXPECT_EQ(PlantId("SPARSETEST#5000"), early);
+    EXPECT_EQ(late.str(), "SPARSETEST#5000");
+    EXPECT_EQ(ids.next(sparse).str(), "SPARSETEST#5001");
+}
+
+// Greenhouse ids, events and inventory records all carry the interned id
+TEST_F(FacadeTestFixture, PlantId_ThreadedThroughGreenhouseAndInventory)
+{
+    Plant* p = facade->getPlant("ROSE001#1");
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(p->getPlantId(), PlantId("ROSE001#1"));
+    EXPECT_EQ(p->id(), "ROSE001#1");
+    EXPECT_EQ(greenhouse->getPlant(PlantId::make("ROSE001", 1)), p);
+
+    std::vector<PlantId> available = inventory->listAvailablePlants();
+    EXPECT_NE(std::find(available.begin(), available.end(), p->getPlantId()), available.end());
+}
+
+// Inventory rows move between per-species status lists in place, with counts kept alongside
+TEST(InventoryTest, StatusListsFollowTransitionsAndKeepCounts)
+{
+    Inventory inv;
+    const SpeciesIndex fern = SkuTable::intern("INVTEST-FERN");
+    const SpeciesIndex moss = SkuTable::intern("INVTEST-MOSS");
+    std::uint32_t rows[4];
+    for (std::uint32_t i = 0; i < 4; ++i)
+    {
+        rows[i] = inv.add(PlantId::make(fern, i + 1), fern, Inventory::Status::Available);
+    }
+    inv.add(PlantId::make(moss, 1), moss, Inventory::Status::Available);
+
+    EXPECT_EQ(inv.find(PlantId::make(fern, 3)), rows[2]);
+    EXPECT_EQ(inv.find(PlantId::make(fern, 9)), Inventory::kNoRow);
+    EXPECT_EQ(inv.count(fern, Inventory::Status::Available), 4);
+    EXPECT_EQ(inv.count(kNoSpecies, Inventory::Status::Available), 0);
+
+    inv.setStatus(rows[1], Inventory::Status::Reserved);
+    inv.setStatus(rows[2], Inventory::Status::Sold);
+    inv.setStatus(rows[2], Inventory::Status::Sold);
+    EXPECT_EQ(inv.count(fern, Inventory::Status::Available), 2);
+    EXPECT_EQ(inv.count(fern, Inventory::Status::Reserved), 1);
+    EXPECT_EQ(inv.count(fern, Inventory::Status::Sold), 1);
+    EXPECT_EQ(inv.count(moss, Inventory::Status::Available), 1);
+
+    // Lists keep the order rows joined them in.
+    std::vector<std::uint32_t> available;
+    for (std::uint32_t r = inv.first(fern, Inventory::Status::Available); r != Inventory::kNoRow; r = inv.next(r))
+    {
+        available.push_back(r);
+    }
+    EXPECT_EQ(available, (std::vector<std::uint32_t>{ rows[0], rows[3] }));
+
+    inv.setStatus(rows[1], Inventory::Status::Available);
+    EXPECT_EQ(inv.first(fern, Inventory::Status::Reserved), Inventory::kNoRow);
+    EXPECT_EQ(inv.count(fern, Inventory::Status::Available), 3);
+    EXPECT_EQ(inv.statusOf(rows[1]), Inventory::Status::Available);
+    EXPECT_EQ(inv.idOf(rows[1]), PlantId::make(fern, 2));
+}
+
+// Sold and dead plants leave the live rows for the archive, but stay counted per species
+TEST_F(FacadeTestFixture, InventoryArchive_RetiresSoldAndDeadRecords)
+{
+    const char* path = "inventory_archive_test.log";
+    std::remove(path);
+    ASSERT_TRUE(inventoryStore->openArchive(path));
+    const std::uint32_t live = inventoryStore->size();
+
+    EXPECT_TRUE(inventory->reservePlant(PlantId("ROSE001#1")));
+    EXPECT_TRUE(inventory->markSold(PlantId("ROSE001#1")));
+    EXPECT_FALSE(inventory->markSold(PlantId("ROSE001#1")));
+    EXPECT_TRUE(inventory->markSold(PlantId("ROSE001#2")));
+    EXPECT_EQ(inventory->soldCount("ROSE001"), 2);
+    EXPECT_EQ(inventory->reservedCount("ROSE001"), 0);
+    EXPECT_EQ(inventory->availableCount("ROSE001"), 1);
+
+    inventory->onEvent(events::Plant{ PlantId("CACT001#1"), "CACT001", events::PlantType::Died });
+    EXPECT_EQ(inventory->availableCount("CACT001"), 1);
+    EXPECT_EQ(inventoryStore->size(), live - 3);
+    EXPECT_EQ(inventoryStore->find(PlantId("ROSE001#1")), Inventory::kNoRow);
+
+    // A freed row is reused by the next plant, so live rows follow the stock.
+    EXPECT_TRUE(inventory->addPlant(PlantId("ROSE001#9"), "ROSE001"));
+    EXPECT_EQ(inventoryStore->size(), live - 2);
+    EXPECT_EQ(inventory->availableCount("ROSE001"), 2);
+    EXPECT_EQ(inventory->soldCount("ROSE001"), 2);
+
+    inventoryStore->getArchive().flush();
+    EXPECT_EQ(inventoryStore->getArchive().recordCount(), 3u);
+    std::ifstream in(path);
+    std::string id, disposition;
+    long long seconds = 0;
+    std::vector<std::string> records;
+    while (in >> id >> disposition >> seconds) records.push_back(id + " " + disposition);
+    EXPECT_EQ(records, (std::vector<std::string>{ "ROSE001#1 SOLD", "ROSE001#2 SOLD", "CACT001#1 DEAD" }));
+    in.close();
+    std::remove(path);
+}
+
+// String accessors hand out references to the flyweight's and plant's own strings
+TEST_F(FacadeTestFixture, PlantAccessors_ReturnReferencesWithoutCopying)
+{
+    const Plant* p = facade->getPlant("ROSE001#1");
+    ASSERT_NE(p, nullptr);
+    const PlantFlyweight* fly = roseSpecies.get();
+
+    EXPECT_EQ(&p->sku(), &fly->getSku());
+    EXPECT_EQ(&p->name(), &fly->getName());
+    EXPECT_EQ(&p->biome(), &fly->getBiome());
+    EXPECT_EQ(&p->getColour(), &p->getColour());
+    EXPECT_EQ(p->sku(), "ROSE001");
+    EXPECT_EQ(p->name(), "Rose");
+    EXPECT_EQ(p->biome(), "Mediterranean");
+    EXPECT_EQ(p->id(), "ROSE001#1");
+}
+
+// The catalog, greenhouse and inventory all index per-SKU data by the same SpeciesIndex
+TEST_F(FacadeTestFixture, SpeciesIndex_SharedAcrossCatalogGreenhouseAndInventory)
+{
+    SpeciesIndex rose = catalog->indexOf("ROSE001");
+    ASSERT_NE(rose, kNoSpecies);
+    EXPECT_EQ(rose, SkuTable::find("ROSE001"));
+    EXPECT_EQ(SkuTable::name(rose), "ROSE001");
+    EXPECT_EQ(catalog->indexOf("UNKNOWN-SKU"), kNoSpecies);
+
+    EXPECT_EQ(greenhouse->countBySku(rose), greenhouse->countBySku("ROSE001"));
+    EXPECT_EQ(greenhouse->countBySku(kNoSpecies), 0);
+
+    // Ids ROSE001#1..#3 are taken by the fixture, so only #4 and #5 are added.
+    greenhouse->receiveShipment("ROSE001", 5);
+    EXPECT_EQ(greenhouse->countBySku(rose), 5);
+
+    std::unique_ptr<Iterator> it = greenhouse->createSkuIterator(rose);
+    int visited = 0;
+    for (it->first(); !it->isDone(); it->next()) ++visited;
+    EXPECT_EQ(visited, 5);
+
+    EXPECT_EQ(inventory->availableCount("ROSE001"), 3);
+    EXPECT_TRUE(inventory->reservePlant(PlantId("ROSE001#1")));
+    EXPECT_EQ(inventory->availableCount("ROSE001"), 2);
+    EXPECT_EQ(inventory->reservedCount("ROSE001"), 1);
+    EXPECT_EQ(inventory->soldCount("NEVER-SEEN"), 0);
+
+    catalog->remove("ROSE001");
+    EXPECT_EQ(catalog->indexOf("ROSE001"), kNoSpecies);
+    EXPECT_EQ(SkuTable::find("ROSE001"), rose);
+}
+
+// Species traits are plain data on the flyweight and in the plant store's flat table
+TEST_F(FacadeTestFixture, SpeciesTraits_FlatTableMatchesFlyweightGetters)
+{
+    auto* rose = static_cast<SpeciesFlyweight*>(roseSpecies.get());
+    const SpeciesTraits& traits = rose->getTraits();
+    EXPECT_TRUE(traits.careProfile);
+    EXPECT_DOUBLE_EQ(traits.waterSensitivity, rose->getWaterSensitivity());
+    EXPECT_DOUBLE_EQ(traits.insecticideTolerance, rose->getInsecticideTolerance());
+    EXPECT_DOUBLE_EQ(traits.growthRate, rose->getGrowthRate());
+    EXPECT_EQ(traits.thrivingSeason, rose->getThrivingSeason());
+    EXPECT_EQ(traits.cost, rose->getCost());
+
+    PlantStore store;
+    std::unique_ptr<Plant> plant(registry->clone("ROSE001", PlantId("TRAITS#1"), "Red"));
+    const std::uint32_t slot = store.attach(plant.get());
+    const SpeciesTraits& stored = store.traitsAt(store.speciesIndex(slot));
+    EXPECT_DOUBLE_EQ(stored.growthRate, traits.growthRate);
+    EXPECT_DOUBLE_EQ(stored.waterSensitivity, traits.waterSensitivity);
+    EXPECT_EQ(stored.thrivingSeason, traits.thrivingSeason);
+
+    EXPECT_DOUBLE_EQ(SeedlingState::growthThreshold(traits, Season::Spring),
+                     SeedlingState::growthThreshold(rose, Season::Spring));
+    EXPECT_DOUBLE_EQ(GrowingState::maturityThreshold(traits, Season::Winter),
+                     GrowingState::maturityThreshold(rose, Season::Winter));
+}
+
+// A shipment takes its plants from one slab, and dead plants' blocks are reused
+TEST_F(FacadeTestFixture, PlantArena_ShipmentsReuseSlabsThroughFreeList)
+{
+    const PlantArena& arena = greenhouse->getArena();
+    EXPECT_EQ(arena.liveCount(), 0u);
+
+    int before = greenhouse->countBySku("CACT001");
+    greenhouse->receiveShipment("CACT001", 500);
+    std::size_t shipped = static_cast<std::size_t>(greenhouse->countBySku("CACT001") - before);
+    ASSERT_GT(shipped, 0u);
+    EXPECT_EQ(arena.liveCount(), shipped);
+    std::size_t slabs = arena.slabCount();
+    EXPECT_EQ(slabs, 1u);
+
+    Plant* p = greenhouse->getPlant(PlantId::make("CACT001", 499));
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(p->sku(), "CACT001");
+    EXPECT_GT(p->cost(), 0);
+
+    for (std::uint32_t seq = 1; seq <= 500; ++seq) greenhouse->removePlant(PlantId::make("CACT001", seq));
+    EXPECT_EQ(arena.liveCount(), 0u);
+
+    greenhouse->receiveShipment("CACT001", 500);
+    EXPECT_EQ(arena.liveCount(), 500u);
+    EXPECT_EQ(arena.slabCount(), slabs);
+}
+
+// A shipment of a SKU that has no prototype claims no ids, SKUs or arena space
+TEST_F(FacadeTestFixture, ReceiveShipment_UnknownSkuAllocatesNothing)
+{
+    const PlantArena& arena = greenhouse->getArena();
+    const std::size_t skus = SkuTable::size();
+    const std::size_t slabs = arena.slabCount();
+    const std::uint32_t before = PlantId("shipment-before").value();
+
+    std::vector<PlantId> added;
+    greenhouse->receiveShipment("NOPE2", 50000, &added);
+    EXPECT_TRUE(added.empty());
+    EXPECT_EQ(SkuTable::size(), skus);
+    EXPECT_EQ(arena.slabCount(), slabs);
+    EXPECT_EQ(PlantId("shipment-after").value(), before + 1);
+    EXPECT_EQ(greenhouse->getPlantCount(), 5);
+}
+
+// Every plant of a kit points at the kit's one soil mix and pot, and clones share them too
+TEST_F(FacadeTestFixture, SoilAndPot_SharedAcrossKitPlants)
+{
+    Plant* first = greenhouse->getPlant(PlantId("ROSE001#1"));
+    Plant* second = greenhouse->getPlant(PlantId("ROSE001#2"));
+    Plant* cactus = greenhouse->getPlant(PlantId("CACT001#1"));
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    ASSERT_NE(cactus, nullptr);
+
+    EXPECT_EQ(first->getSoilMix(), second->getSoilMix());
+    EXPECT_EQ(first->getPot(), second->getPot());
+    EXPECT_NE(first->getPot(), cactus->getPot());
+
+    MediterraneanFactory medFactory;
+    std::unique_ptr<Plant> fresh(medFactory.createPlant("ROSE001#FRESH", "Red", roseSpecies.get()));
+    EXPECT_EQ(fresh->getSoilMix(), first->getSoilMix());
+    EXPECT_EQ(fresh->getPot(), first->getPot());
+
+    std::unique_ptr<Plant> copy(fresh->clone(PlantId("ROSE001#COPY"), "White"));
+    EXPECT_EQ(copy->getSoilMix(), fresh->getSoilMix());
+    EXPECT_EQ(copy->cost(), fresh->cost());
+    fresh.reset();
+    EXPECT_EQ(copy->getPot()->getCost(), first->getPot()->getCost());
+}
+
+// cloneBatch resolves the prototype once and numbers and colours the clones in order
+TEST_F(FacadeTestFixture, PlantRegistry_CloneBatchNumbersAndColoursClones)
+{
+    const std::vector<std::string> colours{ "Red", "Blue" };
+    std::vector<Plant*> out;
+    EXPECT_EQ(registry->cloneBatch("ROSE001", 3, out, 100, colours), 3u);
+    ASSERT_EQ(out.size(), 3u);
+    EXPECT_EQ(out[0]->id(), "ROSE001#100");
+    EXPECT_EQ(out[2]->id(), "ROSE001#102");
+    EXPECT_EQ(out[0]->getColour(), "Red");
+    EXPECT_EQ(out[1]->getColour(), "Blue");
+    EXPECT_EQ(out[2]->getColour(), "Red");
+    EXPECT_EQ(out[1]->sku(), "ROSE001");
+    for (Plant* p : out) delete p;
+
+    out.clear();
+    EXPECT_EQ(registry->cloneBatch("NOPE001", 5, out, 1, colours), 0u);
+    EXPECT_TRUE(out.empty());
+
+    // A shipment numbers on from the greenhouse's own counter, one id per plant.
+    greenhouse->receiveShipment("CACT001", 4);
+    greenhouse->receiveShipment("CACT001", 2);
+    EXPECT_NE(greenhouse->getPlant(PlantId::make("CACT001", 6)), nullptr);
+    EXPECT_EQ(greenhouse->getPlant(PlantId::make("CACT001", 7)), nullptr);
+    EXPECT_EQ(greenhouse->countBySku("CACT001"), 6);
+}
+
 int main(int argc, char **argv) 
 {
     ::testing::InitGoogleTest(&argc, argv);
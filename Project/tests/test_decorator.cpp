@@ -37,9 +37,9 @@
 
 TEST_CASE("PlantItem base component") {
     SpeciesFlyweight species("TEST_ROSE", "Rose", "Garden", 35, 0.5, 0.5, 1.0, Season::Spring);
-    SandySoilMix* soil = new SandySoilMix();
-    CeramicPot* pot = new CeramicPot();
-    Plant plant("P001", "Red", &species, nullptr, &SeedlingState::getInstance(), soil, pot);
+    SandySoilMix soil;
+    CeramicPot pot;
+    Plant plant(PlantId("P001"), "Red", &species, nullptr, &SeedlingState::getInstance(), &soil, &pot);
     
     PlantItem item(&plant);
     CHECK(item.cost() > 0);
@@ -53,9 +53,9 @@ TEST_CASE("PlantItem base component") {
 
 TEST_CASE("ReinforcedPot decorator") {
     SpeciesFlyweight species("TEST_LILY", "Lily", "Wetland", 40, 0.7, 0.5, 1.0, Season::Summer);
-    SandySoilMix* soil = new SandySoilMix();
-    CeramicPot* pot = new CeramicPot();
-    Plant plant("P002", "White", &species, nullptr, &SeedlingState::getInstance(), soil, pot);
+    SandySoilMix soil;
+    CeramicPot pot;
+    Plant plant(PlantId("P002"), "White", &species, nullptr, &SeedlingState::getInstance(), &soil, &pot);
     
     std::unique_ptr<SaleItem> item(new PlantItem(&plant));
     double baseCost = item->cost();
@@ -72,9 +72,9 @@ TEST_CASE("ReinforcedPot decorator") {
 
 TEST_CASE("GiftWrap decorator") {
     SpeciesFlyweight species("TEST_TULIP", "Tulip", "Garden", 20, 0.5, 0.5, 1.0, Season::Spring);
-    SandySoilMix* soil = new SandySoilMix();
-    CeramicPot* pot = new CeramicPot();
-    Plant plant("P003", "Yellow", &species, nullptr, &SeedlingState::getInstance(), soil, pot);
+    SandySoilMix soil;
+    CeramicPot pot;
+    Plant plant(PlantId("P003"), "Yellow", &species, nullptr, &SeedlingState::getInstance(), &soil, &pot);
     
     std::unique_ptr<SaleItem> item(new PlantItem(&plant));
     double baseCost = item->cost();
@@ -91,9 +91,9 @@ TEST_CASE("GiftWrap decorator") {
 
 TEST_CASE("MessageCard decorator") {
     SpeciesFlyweight species("TEST_ORCHID", "Orchid", "Tropical", 50, 0.6, 0.4, 0.8, Season::Summer);
-    SandySoilMix* soil = new SandySoilMix();
-    CeramicPot* pot = new CeramicPot();
-    Plant plant("P004", "Pink", &species, nullptr, &SeedlingState::getInstance(), soil, pot);
+    SandySoilMix soil;
+    CeramicPot pot;
+    Plant plant(PlantId("P004"), "Pink", &species, nullptr, &SeedlingState::getInstance(), &soil, &pot);
     
     std::unique_ptr<SaleItem> item(new PlantItem(&plant));
     double baseCost = item->cost();
@@ -111,9 +111,9 @@ TEST_CASE("MessageCard decorator") {
 
 TEST_CASE("Multiple decorators - ReinforcedPot and GiftWrap") {
     SpeciesFlyweight species("TEST_CACTUS", "Cactus", "Desert", 15, 0.2, 0.9, 0.5, Season::Summer);
-    SandySoilMix* soil = new SandySoilMix();
-    CeramicPot* pot = new CeramicPot();
-    Plant plant("P005", "Green", &species, nullptr, &SeedlingState::getInstance(), soil, pot);
+    SandySoilMix soil;
+    CeramicPot pot;
+    Plant plant(PlantId("P005"), "Green", &species, nullptr, &SeedlingState::getInstance(), &soil, &pot);
     
     std::unique_ptr<SaleItem> item(new PlantItem(&plant));
     double baseCost = item->cost();
@@ -130,9 +130,9 @@ TEST_CASE("Multiple decorators - ReinforcedPot and GiftWrap") {
 
 TEST_CASE("Multiple decorators - All three") {
     SpeciesFlyweight species("TEST_SUNFLOWER", "Sunflower", "Garden", 25, 0.5, 0.6, 1.2, Season::Summer);
-    SandySoilMix* soil = new SandySoilMix();
-    CeramicPot* pot = new CeramicPot();
-    Plant plant("P006", "Yellow", &species, nullptr, &SeedlingState::getInstance(), soil, pot);
+    SandySoilMix soil;
+    CeramicPot pot;
+    Plant plant(PlantId("P006"), "Yellow", &species, nullptr, &SeedlingState::getInstance(), &soil, &pot);
     
     std::unique_ptr<SaleItem> item(new PlantItem(&plant));
     double baseCost = item->cost();
@@ -150,12 +150,12 @@ TEST_CASE("Multiple decorators - All three") {
 
 TEST_CASE("Decorator order independence") {
     SpeciesFlyweight species("TEST_IVY", "Ivy", "Indoor", 30, 0.6, 0.5, 0.9, Season::Spring);
-    SandySoilMix* soil1 = new SandySoilMix();
-    CeramicPot* pot1 = new CeramicPot();
-    SandySoilMix* soil2 = new SandySoilMix();
-    CeramicPot* pot2 = new CeramicPot();
-    Plant plant1("P007A", "Green", &species, nullptr, &SeedlingState::getInstance(), soil1, pot1);
-    Plant plant2("P007B", "Green", &species, nullptr, &SeedlingState::getInstance(), soil2, pot2);
+    SandySoilMix soil1;
+    CeramicPot pot1;
+    SandySoilMix soil2;
+    CeramicPot pot2;
+    Plant plant1(PlantId("P007A"), "Green", &species, nullptr, &SeedlingState::getInstance(), &soil1, &pot1);
+    Plant plant2(PlantId("P007B"), "Green", &species, nullptr, &SeedlingState::getInstance(), &soil2, &pot2);
     
     std::unique_ptr<SaleItem> item1(new PlantItem(&plant1));
     double baseCost = item1->cost();
@@ -177,9 +177,9 @@ TEST_CASE("Decorator order independence") {
 
 TEST_CASE("Same decorator applied twice") {
     SpeciesFlyweight species("TEST_FERN", "Fern", "Shade", 10, 0.7, 0.5, 1.0, Season::Autumn);
-    SandySoilMix* soil = new SandySoilMix();
-    CeramicPot* pot = new CeramicPot();
-    Plant plant("P008", "Green", &species, nullptr, &SeedlingState::getInstance(), soil, pot);
+    SandySoilMix soil;
+    CeramicPot pot;
+    Plant plant(PlantId("P008"), "Green", &species, nullptr, &SeedlingState::getInstance(), &soil, &pot);
     
     std::unique_ptr<SaleItem> item(new PlantItem(&plant));
     double baseCost = item->cost();
@@ -196,9 +196,9 @@ TEST_CASE("Same decorator applied twice") {
 
 TEST_CASE("MessageCard with empty message") {
     SpeciesFlyweight species("TEST_DAISY", "Daisy", "Garden", 18, 0.5, 0.5, 1.0, Season::Spring);
-    SandySoilMix* soil = new SandySoilMix();
-    CeramicPot* pot = new CeramicPot();
-    Plant plant("P009", "White", &species, nullptr, &SeedlingState::getInstance(), soil, pot);
+    SandySoilMix soil;
+    CeramicPot pot;
+    Plant plant(PlantId("P009"), "White", &species, nullptr, &SeedlingState::getInstance(), &soil, &pot);
     
     std::unique_ptr<SaleItem> item(new PlantItem(&plant));
     double baseCost = item->cost();
@@ -215,9 +215,9 @@ TEST_CASE("MessageCard with empty message") {
 
 TEST_CASE("MessageCard with long message") {
     SpeciesFlyweight species("TEST_VIOLET", "Violet", "Garden", 12, 0.6, 0.5, 1.0, Season::Spring);
-    SandySoilMix* soil = new SandySoilMix();
-    CeramicPot* pot = new CeramicPot();
-    Plant plant("P010", "Purple", &species, nullptr, &SeedlingState::getInstance(), soil, pot);
+    SandySoilMix soil;
+    CeramicPot pot;
+    Plant plant(PlantId("P010"), "Purple", &species, nullptr, &SeedlingState::getInstance(), &soil, &pot);
     
     std::unique_ptr<SaleItem> item(new PlantItem(&plant));
     double baseCost = item->cost();
@@ -235,9 +235,9 @@ TEST_CASE("MessageCard with long message") {
 
 TEST_CASE("Polymorphic SaleItem pointer") {
     SpeciesFlyweight species("TEST_BAMBOO", "Bamboo", "Tropical", 22, 0.7, 0.6, 1.5, Season::Summer);
-    SandySoilMix* soil = new SandySoilMix();
-    CeramicPot* pot = new CeramicPot();
-    Plant plant("P011", "Green", &species, nullptr, &SeedlingState::getInstance(), soil, pot);
+    SandySoilMix soil;
+    CeramicPot pot;
+    Plant plant(PlantId("P011"), "Green", &species, nullptr, &SeedlingState::getInstance(), &soil, &pot);
     
     // Store as base SaleItem pointer - tests polymorphism
     SaleItem* basePtr = new PlantItem(&plant);
@@ -256,9 +256,9 @@ TEST_CASE("Polymorphic SaleItem pointer") {
 
 TEST_CASE("Description contains all decorator info in order") {
     SpeciesFlyweight species("TEST_MARIGOLD", "Marigold", "Garden", 8, 0.5, 0.6, 1.0, Season::Autumn);
-    SandySoilMix* soil = new SandySoilMix();
-    CeramicPot* pot = new CeramicPot();
-    Plant plant("P012", "Orange", &species, nullptr, &SeedlingState::getInstance(), soil, pot);
+    SandySoilMix soil;
+    CeramicPot pot;
+    Plant plant(PlantId("P012"), "Orange", &species, nullptr, &SeedlingState::getInstance(), &soil, &pot);
     
     std::unique_ptr<SaleItem> item(new PlantItem(&plant));
     std::unique_ptr<SaleItem> withPot(new ReinforcedPot(std::move(item)));
@@ -36,7 +36,7 @@ TEST_CASE("Observer Unit: registration and basic plant notifications")
     CustomerDash customer;
 
     // No observers registered -> notifications should be no-ops / not crash
-    events::Plant p0{ "P0", "SKU0", events::PlantType::Matured };
+    events::Plant p0{ PlantId("P0"), "SKU0", events::PlantType::Matured };
     subject.notifyPlant(p0);
 
     // Register both observers
@@ -49,7 +49,7 @@ TEST_CASE("Observer Unit: registration and basic plant notifications")
         staff.clear();
         customer.clear();
 
-        events::Plant matured{ "PLANT-UNIT-1", "ROSE001", events::PlantType::Matured };
+        events::Plant matured{ PlantId("PLANT-UNIT-1"), "ROSE001", events::PlantType::Matured };
         subject.notifyPlant(matured);
 
         // CustomerDash should record matured plant id
@@ -72,7 +72,7 @@ TEST_CASE("Observer Unit: registration and basic plant notifications")
         staff.clear();
         customer.clear();
 
-        events::Plant wilted{ "PLANT-UNIT-2", "CACT001", events::PlantType::Wilted };
+        events::Plant wilted{ PlantId("PLANT-UNIT-2"), "CACT001", events::PlantType::Wilted };
         subject.notifyPlant(wilted);
 
         // CustomerDash should not record wilted events
@@ -153,7 +153,7 @@ TEST_CASE("Observer Unit: multiple observers and null-pointer robustness")
     subject.addObserver(&staff2);
     subject.addObserver(&customer);
 
-    events::Plant matured{ "PLANT-UNIT-3", "SKU-X", events::PlantType::Matured };
+    events::Plant matured{ PlantId("PLANT-UNIT-3"), "SKU-X", events::PlantType::Matured };
     subject.notifyPlant(matured);
 
     // Both staff dashboards should have smae alerts
@@ -23,6 +23,11 @@
 #include "../WiltingState.h"
 #include "../DeadState.h"
 #include "../SpeciesFlyweight.h"
+#include "../PlantStore.h"
+#include "../TickKernel.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 // ============================================================================
 // TEST 1: SINGLETON PATTERN VERIFICATION
@@ -75,7 +80,7 @@ TEST_CASE("State Pattern - Forward State Transitions") {
     SUBCASE("Growing → Dead (complete health depletion)") {
         SpeciesFlyweight species("TEST001", "Test Plant", "Indoor", 100,
                                  0.5, 0.5, 1.0, Season::Spring);
-        Plant plant("forward1", "green", &species, nullptr, &GrowingState::getInstance(), nullptr, nullptr);
+        Plant plant(PlantId("forward1"), "green", &species, nullptr, &GrowingState::getInstance(), nullptr, nullptr);
 
         CHECK(plant.getPlantState()->name() == "Growing");
 
@@ -90,7 +95,7 @@ TEST_CASE("State Pattern - Forward State Transitions") {
     SUBCASE("Growing → Wilting (low health)") {
         SpeciesFlyweight species("TEST002", "Test Plant 2", "Indoor", 100,
                                  0.5, 0.5, 1.0, Season::Spring);
-        Plant plant("forward2", "green", &species, nullptr, &GrowingState::getInstance(), nullptr, nullptr);
+        Plant plant(PlantId("forward2"), "green", &species, nullptr, &GrowingState::getInstance(), nullptr, nullptr);
 
         CHECK(plant.getPlantState()->name() == "Growing");
 
@@ -105,7 +110,7 @@ TEST_CASE("State Pattern - Forward State Transitions") {
     SUBCASE("Mature → Wilting (mature plant declining)") {
         SpeciesFlyweight species("TEST003", "Test Plant 3", "Indoor", 100,
                                  0.5, 0.5, 1.0, Season::Spring);
-        Plant plant("forward3", "green", &species, nullptr, &MatureState::getInstance(), nullptr, nullptr);
+        Plant plant(PlantId("forward3"), "green", &species, nullptr, &MatureState::getInstance(), nullptr, nullptr);
 
         CHECK(plant.getPlantState()->name() == "Matured");
 
@@ -120,7 +125,7 @@ TEST_CASE("State Pattern - Forward State Transitions") {
     SUBCASE("Mature → Dead (complete health depletion)") {
         SpeciesFlyweight species("TEST004", "Test Plant 4", "Indoor", 100,
                                  0.5, 0.5, 1.0, Season::Spring);
-        Plant plant("forward4", "green", &species, nullptr, &MatureState::getInstance(), nullptr, nullptr);
+        Plant plant(PlantId("forward4"), "green", &species, nullptr, &MatureState::getInstance(), nullptr, nullptr);
 
         CHECK(plant.getPlantState()->name() == "Matured");
 
@@ -142,7 +147,7 @@ TEST_CASE("State Pattern - Backward State Transitions (Recovery)") {
     SUBCASE("Wilting → Mature (recovery from wilting)") {
         SpeciesFlyweight species("TEST005", "Test Plant 5", "Indoor", 100,
                                  0.5, 0.5, 1.0, Season::Spring);
-        Plant plant("backward1", "green", &species, nullptr, &WiltingState::getInstance(), nullptr, nullptr);
+        Plant plant(PlantId("backward1"), "green", &species, nullptr, &WiltingState::getInstance(), nullptr, nullptr);
 
         // Start in Wilting state
         CHECK(plant.getPlantState()->name() == "Wilting");
@@ -163,7 +168,7 @@ TEST_CASE("State Pattern - Backward State Transitions (Recovery)") {
     SUBCASE("Wilting stays Wilting with insufficient health") {
         SpeciesFlyweight species("TEST006", "Test Plant 6", "Indoor", 100,
                                  0.5, 0.5, 1.0, Season::Spring);
-        Plant plant("backward2", "green", &species, nullptr, &WiltingState::getInstance(), nullptr, nullptr);
+        Plant plant(PlantId("backward2"), "green", &species, nullptr, &WiltingState::getInstance(), nullptr, nullptr);
 
         CHECK(plant.getPlantState()->name() == "Wilting");
 
@@ -184,7 +189,7 @@ TEST_CASE("State Pattern - Backward State Transitions (Recovery)") {
     SUBCASE("Wilting stays Wilting with insufficient moisture") {
         SpeciesFlyweight species("TEST007", "Test Plant 7", "Indoor", 100,
                                  0.5, 0.5, 1.0, Season::Spring);
-        Plant plant("backward3", "green", &species, nullptr, &WiltingState::getInstance(), nullptr, nullptr);
+        Plant plant(PlantId("backward3"), "green", &species, nullptr, &WiltingState::getInstance(), nullptr, nullptr);
 
         CHECK(plant.getPlantState()->name() == "Wilting");
 
@@ -202,7 +207,7 @@ TEST_CASE("State Pattern - Backward State Transitions (Recovery)") {
     SUBCASE("Complete cycle: Mature → Wilting → Mature (forward then backward)") {
         SpeciesFlyweight species("TEST008", "Test Plant 8", "Indoor", 100,
                                  0.5, 0.5, 1.0, Season::Spring);
-        Plant plant("cycle", "green", &species, nullptr, &MatureState::getInstance(), nullptr, nullptr);
+        Plant plant(PlantId("cycle"), "green", &species, nullptr, &MatureState::getInstance(), nullptr, nullptr);
 
         // Start Mature
         CHECK(plant.getPlantState()->name() == "Matured");
@@ -231,7 +236,7 @@ TEST_CASE("State Pattern - DeadState is Final/Terminal") {
     SUBCASE("Dead state never transitions - no outgoing states") {
         SpeciesFlyweight species("TEST009", "Dead Plant Test", "Indoor", 100,
                                  0.5, 0.5, 1.0, Season::Spring);
-        Plant plant("dead1", "brown", &species, nullptr, &DeadState::getInstance(), nullptr, nullptr);
+        Plant plant(PlantId("dead1"), "brown", &species, nullptr, &DeadState::getInstance(), nullptr, nullptr);
 
         // Confirm starts as Dead
         CHECK(plant.getPlantState()->name() == "Dead");
@@ -256,7 +261,7 @@ TEST_CASE("State Pattern - DeadState is Final/Terminal") {
     SUBCASE("Dead state checkChange() does nothing") {
         SpeciesFlyweight species("TEST010", "Dead Plant Test 2", "Indoor", 100,
                                  0.5, 0.5, 1.0, Season::Spring);
-        Plant plant("dead2", "brown", &species, nullptr, &DeadState::getInstance(), nullptr, nullptr);
+        Plant plant(PlantId("dead2"), "brown", &species, nullptr, &DeadState::getInstance(), nullptr, nullptr);
 
         CHECK(plant.getPlantState()->name() == "Dead");
 
@@ -272,28 +277,28 @@ TEST_CASE("State Pattern - DeadState is Final/Terminal") {
                                  0.5, 0.5, 1.0, Season::Spring);
 
         // Test from Seedling
-        Plant p1("dying1", "green", &species, nullptr, &SeedlingState::getInstance(), nullptr, nullptr);
+        Plant p1(PlantId("dying1"), "green", &species, nullptr, &SeedlingState::getInstance(), nullptr, nullptr);
         p1.setState(&DeadState::getInstance());
         p1.addHealth(100);
         p1.getPlantState()->checkChange(p1);
         CHECK(p1.getPlantState()->name() == "Dead");
 
         // Test from Growing
-        Plant p2("dying2", "green", &species, nullptr, &GrowingState::getInstance(), nullptr, nullptr);
+        Plant p2(PlantId("dying2"), "green", &species, nullptr, &GrowingState::getInstance(), nullptr, nullptr);
         p2.setState(&DeadState::getInstance());
         p2.addHealth(100);
         p2.getPlantState()->checkChange(p2);
         CHECK(p2.getPlantState()->name() == "Dead");
 
         // Test from Mature
-        Plant p3("dying3", "green", &species, nullptr, &MatureState::getInstance(), nullptr, nullptr);
+        Plant p3(PlantId("dying3"), "green", &species, nullptr, &MatureState::getInstance(), nullptr, nullptr);
         p3.setState(&DeadState::getInstance());
         p3.addHealth(100);
         p3.getPlantState()->checkChange(p3);
         CHECK(p3.getPlantState()->name() == "Dead");
 
         // Test from Wilting
-        Plant p4("dying4", "green", &species, nullptr, &WiltingState::getInstance(), nullptr, nullptr);
+        Plant p4(PlantId("dying4"), "green", &species, nullptr, &WiltingState::getInstance(), nullptr, nullptr);
         p4.setState(&DeadState::getInstance());
         p4.addHealth(100);
         p4.getPlantState()->checkChange(p4);
@@ -309,7 +314,7 @@ TEST_CASE("State Pattern - DeadState is Final/Terminal") {
     SUBCASE("Dead state reached through natural health depletion from Wilting") {
         SpeciesFlyweight species("TEST012", "Neglected Plant", "Indoor", 100,
                                  0.5, 0.5, 1.0, Season::Spring);
-        Plant plant("natural_death", "green", &species, nullptr, &WiltingState::getInstance(), nullptr, nullptr);
+        Plant plant(PlantId("natural_death"), "green", &species, nullptr, &WiltingState::getInstance(), nullptr, nullptr);
 
         // Start wilting
         CHECK(plant.getPlantState()->name() == "Wilting");
@@ -328,3 +333,180 @@ TEST_CASE("State Pattern - DeadState is Final/Terminal") {
         CHECK(plant.getPlantState()->name() == "Dead");
     }
 }
+
+// ============================================================================
+// TEST 7: BATCH KERNEL MATCHES THE STATE CLASSES
+// ============================================================================
+
+TEST_CASE("State Pattern - TickKernel matches checkChange") {
+    // Negative, zero and positive growth rates put the maturity thresholds below, at and
+    // above a fresh plant's age, so both outcomes of the age check are exercised.
+    SpeciesFlyweight fast("KRN001", "Fast", "Indoor", 10, 0.5, 0.5, -1.0, Plant::currentSeason());
+    SpeciesFlyweight edge("KRN002", "Edge", "Indoor", 10, 0.5, 0.5, 0.0, Season::Winter);
+    SpeciesFlyweight slow("KRN003", "Slow", "Indoor", 10, 0.5, 0.5, 3.0, Season::Summer);
+    PlantFlyweight* species[] = { &fast, &edge, &slow };
+
+    std::vector<std::int32_t> seedlingLimits, growingLimits;
+    for (PlantFlyweight* sp : species) {
+        seedlingLimits.push_back(TickContext::ageLimit(SeedlingState::growthThreshold(sp, Plant::currentSeason())));
+        growingLimits.push_back(TickContext::ageLimit(GrowingState::maturityThreshold(sp, Plant::currentSeason())));
+    }
+
+    const TickKernel::Isa isas[] = { TickKernel::Isa::Scalar, TickKernel::Isa::Sse41, TickKernel::Isa::Avx2 };
+    for (TickKernel::Isa isa : isas) {
+        if (!TickKernel::supported(isa)) continue;
+        CAPTURE(static_cast<int>(isa));
+
+        // 203 plants: not a multiple of 4 or 8, so the scalar tail runs as well.
+        const std::size_t count = 203;
+        std::uint32_t seed = 12345;
+        auto next = [&seed](std::uint32_t bound) { seed = seed * 1103515245u + 12345u; return (seed >> 8) % bound; };
+
+        std::vector<std::unique_ptr<Plant>> plants;
+        std::vector<std::int32_t> moisture(count), health(count), insecticide(count), ages(count);
+        std::vector<std::uint8_t> state(count);
+        std::vector<std::uint16_t> speciesIdx(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            speciesIdx[i] = static_cast<std::uint16_t>(next(3));
+            auto plant = std::make_unique<Plant>(PlantId("k" + std::to_string(i)), "green", species[speciesIdx[i]], nullptr,
+                                                 PlantStore::stateAt(static_cast<std::uint8_t>(next(5))), nullptr, nullptr);
+            plant->addWater(static_cast<int>(next(101)) - plant->getMoisture());
+            plant->addInsecticide(static_cast<int>(next(101)) - plant->getInsecticide());
+            plant->addHealth(static_cast<int>(next(101)) - plant->getHealth());
+
+            moisture[i] = plant->getMoisture();
+            health[i] = plant->getHealth();
+            insecticide[i] = plant->getInsecticide();
+            state[i] = PlantStore::indexOf(plant->getPlantState());
+            plants.push_back(std::move(plant));
+        }
+        // A vacant slot must be left alone.
+        state[7] = PlantStore::kVacant;
+
+        TickKernel::Batch batch;
+        batch.moisture = moisture.data();
+        batch.health = health.data();
+        batch.insecticide = insecticide.data();
+        batch.state = state.data();
+        batch.species = speciesIdx.data();
+        batch.ageDays = ages.data();
+        batch.seedlingAgeLimit = seedlingLimits.data();
+        batch.growingAgeLimit = growingLimits.data();
+        batch.count = count;
+
+        for (int tick = 0; tick < 30; ++tick) {
+            for (std::size_t i = 0; i < count; ++i) {
+                ages[i] = plants[i]->getAgeDays();
+                if (i != 7) plants[i]->getPlantState()->checkChange(*plants[i]);
+            }
+            const std::int32_t vacantHealth = health[7];
+            TickKernel::run(batch, isa);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                if (i == 7) continue;
+                CAPTURE(i);
+                CHECK(moisture[i] == plants[i]->getMoisture());
+                CHECK(health[i] == plants[i]->getHealth());
+                CHECK(insecticide[i] == plants[i]->getInsecticide());
+                CHECK(PlantStore::stateAt(state[i]) == plants[i]->getPlantState());
+            }
+            CHECK(state[7] == PlantStore::kVacant);
+            CHECK(health[7] == vacantHealth);
+        }
+    }
+}
+
+// ============================================================================
+// TEST 8: TICK CONTEXT FREEZES TIME FOR THE STATE MACHINE
+// ============================================================================
+
+TEST_CASE("State Pattern - TickContext drives age-based transitions") {
+    SpeciesFlyweight species("CTX001", "Context Plant", "Indoor", 10, 0.5, 0.5, 1.0, Season::Spring);
+    Plant plant(PlantId("ctx1"), "green", &species, nullptr, &SeedlingState::getInstance(), nullptr, nullptr);
+    plant.addWater(100);
+    plant.addInsecticide(100);
+    const auto born = plant.getCreatedAt();
+
+    SUBCASE("Context at creation time keeps a seedling young") {
+        TickContext context(born);
+        CHECK(context.ageDays(born) == 0);
+        plant.getPlantState()->checkChange(plant, context);
+        CHECK(plant.getPlantState()->name() == "Seedling");
+    }
+
+    SUBCASE("Installed virtual clock advances plant age without waiting") {
+        VirtualClock clock(born);
+        SimClock* previous = SimClock::install(&clock);
+        CHECK(plant.getAgeDays() == 0);
+
+        plant.getPlantState()->checkChange(plant);
+        CHECK(plant.getPlantState()->name() == "Seedling");
+
+        clock.advanceDays(30);
+        CHECK(plant.getAgeDays() == 30);
+        plant.getPlantState()->checkChange(plant);
+        CHECK(plant.getPlantState()->name() == "Growing");
+        SimClock::install(previous);
+    }
+
+    SUBCASE("Context 30 simulated days later lets the seedling grow and mature") {
+        TickContext context(born + std::chrono::seconds(300));
+        CHECK(context.ageDays(born) == 30);
+        CHECK(context.getSeason() == Plant::seasonAt(born + std::chrono::seconds(300)));
+
+        plant.getPlantState()->checkChange(plant, context);
+        CHECK(plant.getPlantState()->name() == "Growing");
+        plant.getPlantState()->checkChange(plant, context);
+        CHECK(plant.getPlantState()->name() == "Matured");
+    }
+}
+
+// ============================================================================
+// TEST 9: IDLE TICKS IN CLOSED FORM MATCH STEP-BY-STEP TICKS
+// ============================================================================
+
+TEST_CASE("State Pattern - TickKernel idle ticks match single ticks") {
+    std::int32_t noLimit = 0;
+    std::int32_t age = 0;
+    const std::uint8_t mature = PlantStore::indexOf(&MatureState::getInstance());
+    std::size_t skipped = 0;
+
+    for (std::int32_t m = 0; m <= 100; m += 3) {
+        for (std::int32_t ins = 0; ins <= 100; ins += 7) {
+            for (std::int32_t h = 0; h <= 100; h += 5) {
+                const std::uint32_t idle = TickKernel::idleTicks(mature, m, h, ins);
+                CAPTURE(m); CAPTURE(ins); CAPTURE(h); CAPTURE(idle);
+                skipped += idle;
+
+                std::int32_t sm = m, sh = h, si = ins;
+                std::uint8_t st = mature;
+                std::uint16_t sp = 0;
+                TickKernel::Batch batch;
+                batch.moisture = &sm;
+                batch.health = &sh;
+                batch.insecticide = &si;
+                batch.state = &st;
+                batch.species = &sp;
+                batch.ageDays = &age;
+                batch.seedlingAgeLimit = &noLimit;
+                batch.growingAgeLimit = &noLimit;
+                batch.count = 1;
+
+                // Every prefix of the idle run must equal that many single ticks, without a state change.
+                for (std::uint32_t t = 1; t <= std::min<std::uint32_t>(idle, 40); ++t) {
+                    TickKernel::run(batch, TickKernel::Isa::Scalar);
+                    std::int32_t cm = m, ch = h, ci = ins;
+                    TickKernel::advanceIdle(mature, cm, ch, ci, t);
+                    CHECK(st == mature);
+                    CHECK(cm == sm);
+                    CHECK(ch == sh);
+                    CHECK(ci == si);
+                }
+            }
+        }
+    }
+    // Well watered plants do get to skip ticks.
+    CHECK(skipped > 0);
+    CHECK(TickKernel::idleTicks(mature, 100, 100, 100) == 9);
+    CHECK(TickKernel::idleTicks(PlantStore::indexOf(&SeedlingState::getInstance()), 100, 100, 100) == 0);
+}
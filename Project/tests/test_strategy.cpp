@@ -41,7 +41,7 @@ TEST_CASE("DesertStrategy - water Method") {
 
     SUBCASE("Waters when moisture < 30 (adds +15)") {
         // FIX 2: Pass the dummy flyweight instead of nullptr
-        Plant plant("cactus1", "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("cactus1"), "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
         plant.addWater(20 - plant.getMoisture()); // moisture = 20 (< 30)
 
         desert.water(plant);
@@ -52,7 +52,7 @@ TEST_CASE("DesertStrategy - water Method") {
 
     SUBCASE("Boundary: Waters at exactly moisture = 29") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("cactus2", "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("cactus2"), "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
         plant.addWater(29 - plant.getMoisture()); // moisture = 29
 
         desert.water(plant);
@@ -63,7 +63,7 @@ TEST_CASE("DesertStrategy - water Method") {
 
     SUBCASE("Does not water when moisture >= 30 (remains 30)") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("cactus3", "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("cactus3"), "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
         plant.addWater(30 - plant.getMoisture()); // moisture = 30
 
         desert.water(plant);
@@ -82,7 +82,7 @@ TEST_CASE("DesertStrategy - fertilize Method") {
 
     SUBCASE("Fertilizes when health < 60 (adds +5)") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("cactus4", "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("cactus4"), "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
         // FIX 4: Set health below 60 to trigger fertilization (e.g., 50)
         plant.addHealth(50 - plant.getHealth()); 
 
@@ -94,7 +94,7 @@ TEST_CASE("DesertStrategy - fertilize Method") {
 
     SUBCASE("Boundary: Fertilizes at exactly health = 59") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("cactus5", "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("cactus5"), "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
         // FIX 4: Set health to 59
         plant.addHealth(59 - plant.getHealth()); 
 
@@ -106,7 +106,7 @@ TEST_CASE("DesertStrategy - fertilize Method") {
 
     SUBCASE("Does not fertilize when health >= 60 (remains 60)") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("cactus6", "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("cactus6"), "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
         plant.addHealth(60 - plant.getHealth()); // health = 60
 
         desert.fertilize(plant);
@@ -127,7 +127,7 @@ TEST_CASE("TropicalStrategy - water Method") {
 
     SUBCASE("Waters when moisture < 70 (adds +25)") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("tropical1", "green", &DUMMY_FLYWEIGHT, &tropical, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("tropical1"), "green", &DUMMY_FLYWEIGHT, &tropical, nullptr, nullptr, nullptr);
         plant.addWater(50 - plant.getMoisture()); // moisture = 50
 
         tropical.water(plant);
@@ -138,7 +138,7 @@ TEST_CASE("TropicalStrategy - water Method") {
 
     SUBCASE("Boundary: Waters at exactly moisture = 69") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("tropical2", "green", &DUMMY_FLYWEIGHT, &tropical, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("tropical2"), "green", &DUMMY_FLYWEIGHT, &tropical, nullptr, nullptr, nullptr);
         plant.addWater(69 - plant.getMoisture()); // moisture = 69
 
         tropical.water(plant);
@@ -154,7 +154,7 @@ TEST_CASE("TropicalStrategy - fertilize Method") {
 
     SUBCASE("Fertilizes when health < 60 (adds +10)") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("tropical3", "green", &DUMMY_FLYWEIGHT, &tropical, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("tropical3"), "green", &DUMMY_FLYWEIGHT, &tropical, nullptr, nullptr, nullptr);
         // FIX 4: Set health below 60 to trigger fertilization (e.g., 50)
         plant.addHealth(50 - plant.getHealth()); 
 
@@ -166,7 +166,7 @@ TEST_CASE("TropicalStrategy - fertilize Method") {
 
     SUBCASE("Boundary: Fertilizes at exactly health = 59") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("tropical4", "green", &DUMMY_FLYWEIGHT, &tropical, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("tropical4"), "green", &DUMMY_FLYWEIGHT, &tropical, nullptr, nullptr, nullptr);
         // FIX 4: Set health to 59
         plant.addHealth(59 - plant.getHealth()); 
 
@@ -188,7 +188,7 @@ TEST_CASE("IndoorStrategy - water Method") {
 
     SUBCASE("Waters when moisture < 60 (adds +21)") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("indoor1", "green", &DUMMY_FLYWEIGHT, &indoor, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("indoor1"), "green", &DUMMY_FLYWEIGHT, &indoor, nullptr, nullptr, nullptr);
         plant.addWater(40 - plant.getMoisture()); // moisture = 40
 
         indoor.water(plant);
@@ -199,7 +199,7 @@ TEST_CASE("IndoorStrategy - water Method") {
 
     SUBCASE("Boundary: Waters at exactly moisture = 59") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("indoor2", "green", &DUMMY_FLYWEIGHT, &indoor, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("indoor2"), "green", &DUMMY_FLYWEIGHT, &indoor, nullptr, nullptr, nullptr);
         plant.addWater(59 - plant.getMoisture()); // moisture = 59
 
         indoor.water(plant);
@@ -215,7 +215,7 @@ TEST_CASE("IndoorStrategy - fertilize Method") {
 
     SUBCASE("Fertilizes when health < 60 (adds +7)") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("indoor3", "green", &DUMMY_FLYWEIGHT, &indoor, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("indoor3"), "green", &DUMMY_FLYWEIGHT, &indoor, nullptr, nullptr, nullptr);
         // FIX 4: Set health below 60 to trigger fertilization (e.g., 50)
         plant.addHealth(50 - plant.getHealth()); 
 
@@ -227,7 +227,7 @@ TEST_CASE("IndoorStrategy - fertilize Method") {
 
     SUBCASE("Boundary: Fertilizes at exactly health = 59") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("indoor4", "green", &DUMMY_FLYWEIGHT, &indoor, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("indoor4"), "green", &DUMMY_FLYWEIGHT, &indoor, nullptr, nullptr, nullptr);
         // FIX 4: Set health to 59
         plant.addHealth(59 - plant.getHealth()); 
 
@@ -249,7 +249,7 @@ TEST_CASE("MediterraneanStrategy - water Method") {
 
     SUBCASE("Waters when moisture < 50 (adds +19)") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("med1", "green", &DUMMY_FLYWEIGHT, &med, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("med1"), "green", &DUMMY_FLYWEIGHT, &med, nullptr, nullptr, nullptr);
         plant.addWater(30 - plant.getMoisture()); // moisture = 30
 
         med.water(plant);
@@ -260,7 +260,7 @@ TEST_CASE("MediterraneanStrategy - water Method") {
 
     SUBCASE("Boundary: Waters at exactly moisture = 49") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("med2", "green", &DUMMY_FLYWEIGHT, &med, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("med2"), "green", &DUMMY_FLYWEIGHT, &med, nullptr, nullptr, nullptr);
         plant.addWater(49 - plant.getMoisture()); // moisture = 49
 
         med.water(plant);
@@ -276,7 +276,7 @@ TEST_CASE("MediterraneanStrategy - fertilize Method") {
 
     SUBCASE("Fertilizes when health < 60 (adds +8)") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("med3", "green", &DUMMY_FLYWEIGHT, &med, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("med3"), "green", &DUMMY_FLYWEIGHT, &med, nullptr, nullptr, nullptr);
         // FIX 4: Set health below 60 to trigger fertilization (e.g., 50)
         plant.addHealth(50 - plant.getHealth()); 
 
@@ -288,7 +288,7 @@ TEST_CASE("MediterraneanStrategy - fertilize Method") {
 
     SUBCASE("Boundary: Fertilizes at exactly health = 59") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("med4", "green", &DUMMY_FLYWEIGHT, &med, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("med4"), "green", &DUMMY_FLYWEIGHT, &med, nullptr, nullptr, nullptr);
         // FIX 4: Set health to 59
         plant.addHealth(59 - plant.getHealth()); 
 
@@ -310,7 +310,7 @@ TEST_CASE("WetlandStrategy - water Method") {
 
     SUBCASE("Waters when moisture < 80 (adds +31)") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("wetland1", "green", &DUMMY_FLYWEIGHT, &wetland, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("wetland1"), "green", &DUMMY_FLYWEIGHT, &wetland, nullptr, nullptr, nullptr);
         plant.addWater(60 - plant.getMoisture()); // moisture = 60
 
         wetland.water(plant);
@@ -321,7 +321,7 @@ TEST_CASE("WetlandStrategy - water Method") {
 
     SUBCASE("Boundary: Waters at exactly moisture = 79") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("wetland2", "green", &DUMMY_FLYWEIGHT, &wetland, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("wetland2"), "green", &DUMMY_FLYWEIGHT, &wetland, nullptr, nullptr, nullptr);
         plant.addWater(79 - plant.getMoisture()); // moisture = 79
 
         wetland.water(plant);
@@ -337,7 +337,7 @@ TEST_CASE("WetlandStrategy - fertilize Method") {
 
     SUBCASE("Fertilizes when health < 60 (adds +13)") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("wetland3", "green", &DUMMY_FLYWEIGHT, &wetland, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("wetland3"), "green", &DUMMY_FLYWEIGHT, &wetland, nullptr, nullptr, nullptr);
         // FIX 4: Set health below 60 to trigger fertilization (e.g., 50)
         plant.addHealth(50 - plant.getHealth()); 
 
@@ -349,7 +349,7 @@ TEST_CASE("WetlandStrategy - fertilize Method") {
 
     SUBCASE("Boundary: Fertilizes at exactly health = 59") {
         // FIX 2: Pass the dummy flyweight
-        Plant plant("wetland4", "green", &DUMMY_FLYWEIGHT, &wetland, nullptr, nullptr, nullptr);
+        Plant plant(PlantId("wetland4"), "green", &DUMMY_FLYWEIGHT, &wetland, nullptr, nullptr, nullptr);
         // FIX 4: Set health to 59
         plant.addHealth(59 - plant.getHealth()); 
 
@@ -367,7 +367,7 @@ TEST_CASE("WetlandStrategy - fertilize Method") {
 TEST_CASE("Strategy Pattern - Plant Delegation") {
     DesertStrategy desert;
     // FIX 2: Pass the dummy flyweight
-    Plant plant("delegator", "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
+    Plant plant(PlantId("delegator"), "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
 
     SUBCASE("Plant delegates water() to strategy") {
         plant.addWater(20 - plant.getMoisture()); // moisture = 20
@@ -404,11 +404,11 @@ TEST_CASE("Strategy Pattern - Strategy Comparison") {
     WetlandStrategy wetland;
 
     // FIX 2: Pass the dummy flyweight to all plants
-    Plant d("d", "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
-    Plant t("t", "green", &DUMMY_FLYWEIGHT, &tropical, nullptr, nullptr, nullptr);
-    Plant i("i", "green", &DUMMY_FLYWEIGHT, &indoor, nullptr, nullptr, nullptr);
-    Plant m("m", "green", &DUMMY_FLYWEIGHT, &med, nullptr, nullptr, nullptr);
-    Plant w("w", "green", &DUMMY_FLYWEIGHT, &wetland, nullptr, nullptr, nullptr);
+    Plant d(PlantId("d"), "green", &DUMMY_FLYWEIGHT, &desert, nullptr, nullptr, nullptr);
+    Plant t(PlantId("t"), "green", &DUMMY_FLYWEIGHT, &tropical, nullptr, nullptr, nullptr);
+    Plant i(PlantId("i"), "green", &DUMMY_FLYWEIGHT, &indoor, nullptr, nullptr, nullptr);
+    Plant m(PlantId("m"), "green", &DUMMY_FLYWEIGHT, &med, nullptr, nullptr, nullptr);
+    Plant w(PlantId("w"), "green", &DUMMY_FLYWEIGHT, &wetland, nullptr, nullptr, nullptr);
 
 
     SUBCASE("All strategies have different water amounts") {